@@ -0,0 +1,46 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include <SDL2/SDL.h>
+
+// 이미지 디코딩 작업 풀
+// - 디코딩(픽셀 캐시 읽기 또는 IMG_Load + RGBA 변환)만 워커 스레드에서 하고, 텍스처 생성은 렌더 스레드가 결과를 가져가서 함
+// - 작업은 넣은 순서대로 처리. 아직 대기 중인 작업을 기다리면 호출 스레드가 직접 디코딩함
+
+#define ASSET_LOADER_MAX_JOBS 128
+#define ASSET_LOADER_MAX_THREADS 4
+
+// 디코딩 결과: 항상 SDL_PIXELFORMAT_RGBA32 픽셀
+// - PNG를 디코딩했으면 surface가, 픽셀 캐시 파일에서 읽었으면 mapping(mmap)이 pixels를 소유
+typedef struct
+{
+    const void *pixels; // 실패면 NULL
+    int w;
+    int h;
+    int pitch;
+    SDL_Surface *surface;
+    void *mapping;
+    size_t mapping_size;
+} AssetImage;
+
+// 호출 스레드에서 바로 디코딩 (픽셀 캐시 → 없으면 IMG_Load). 성공하면 0
+int asset_image_load(const char *path, AssetImage *out);
+void asset_image_free(AssetImage *image);
+
+// threads: 0이면 (코어 수 - 1), 1 ~ ASSET_LOADER_MAX_THREADS
+int asset_loader_init(int threads);
+
+// 남은 작업을 버리고 워커 종료 (가져가지 않은 결과는 해제)
+void asset_loader_shutdown(void);
+
+// 디코딩 요청. 작업 번호 반환, 실패 시 -1
+int asset_loader_submit(const char *path);
+
+// 끝난 작업 결과 가져가기 (소유권 이전, 다 쓰면 asset_image_free. 디코딩 실패면 out->pixels == NULL)
+// - 아직 안 끝났으면 0, 가져갔으면 1
+int asset_loader_poll(int ticket, AssetImage *out);
+
+// 끝날 때까지 기다려 결과 가져가기 (poll과 같은 규칙, 잘못된 작업 번호면 out->pixels == NULL)
+void asset_loader_wait(int ticket, AssetImage *out);
+
+#endif // ASSET_LOADER_H
@@ -0,0 +1,10 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+// 커맨드라인 벤치마크 (SDL 초기화 없이 실행하고 종료)
+
+// 교수를 MAX_OBSTACLES까지 채운 보스 러시 맵에서 move_obstacles를
+// 잡 워커 1~max_threads개로 ticks번씩 돌려 틱당 시간/속도 향상/결정성 출력
+int run_obstacle_benchmark(int stage_id, int max_threads, int ticks);
+
+#endif // BENCH_H
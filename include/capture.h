@@ -0,0 +1,37 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+// 플레이 영상 녹화
+// - 렌더 스레드는 정해진 간격마다 화면을 미리 할당한 링 슬롯에 읽어 넣기만 함
+// - 변환(YUV)과 파일 쓰기는 인코더 스레드가 하고, 빈 슬롯이 없으면 기다리지 않고 그 프레임을 버림
+// - 버린 프레임/화면을 그리지 않은 구간은 인코더가 직전 프레임을 반복해 재생 속도를 맞춤
+// - 출력: 경로가 .y4m이면 YUV4MPEG2 (4:2:0, 무압축), 그 밖에는 ARGB8888 프레임을 이어 붙인 raw
+
+#define CAPTURE_RING_SLOTS 6
+#define CAPTURE_DEFAULT_FPS 30
+
+typedef struct
+{
+    unsigned long grabbed;  // 화면을 읽어 인코더에 넘긴 프레임
+    unsigned long written;  // 파일에 쓴 프레임 (반복 포함)
+    unsigned long repeated; // 빈 구간을 메우려고 반복해 쓴 프레임
+    unsigned long dropped;  // 인코더가 밀려 빈 슬롯이 없어서 버린 프레임
+    unsigned long failed;   // 화면 읽기 실패
+} CaptureStats;
+
+// 녹화 시작 (width/height: 읽어 올 화면 크기, Y4M이면 짝수). 성공하면 0
+int capture_start(const char *path, int width, int height, int fps);
+
+// 남은 프레임을 모두 쓰고 인코더 종료 후 결과 출력
+void capture_stop(void);
+
+int capture_active(void);
+
+// 렌더 스레드: 이번 프레임을 녹화할 차례이고 빈 슬롯이 있으면 슬롯 픽셀 버퍼(ARGB8888, pitch = width * 4) 반환
+// - 반환값이 있으면 반드시 capture_end_frame으로 돌려줌 (ok=0이면 읽기 실패로 버림)
+void *capture_begin_frame(void);
+void capture_end_frame(int ok);
+
+void capture_get_stats(CaptureStats *out);
+
+#endif // CAPTURE_H
@@ -0,0 +1,42 @@
+#ifndef DIRTY_RECT_H
+#define DIRTY_RECT_H
+
+#include <SDL2/SDL.h>
+
+// GPU 없는 환경용 더티 사각형 출력
+// - 소프트웨어 렌더러는 창 표면에 직접 그리므로, 이전 프레임과 달라진 영역만 다시 그리고
+//   SDL_UpdateWindowSurfaceRects로 그 영역만 화면에 올림.
+// - 한 프레임의 그리기 호출을 목록으로 기록한 뒤, 화면을 32px 셀로 나눠 셀마다 그 셀을 덮는
+//   호출들의 해시를 만들고 직전 프레임 해시와 다른 셀만 다시 그림.
+// - 텍스처 내용이 바뀌는 경우(텍스트 캐시 재생성 등)는 해시로 알 수 없으므로
+//   dirty_rect_invalidate로 전체를 다시 그리게 해야 함.
+
+#define DIRTY_RECT_CELL_SIZE 32
+#define DIRTY_RECT_MAX_RECTS 64
+
+typedef struct DirtyRectTracker DirtyRectTracker;
+
+DirtyRectTracker *dirty_rect_create(int width, int height);
+void dirty_rect_destroy(DirtyRectTracker *tracker);
+
+// 다음 프레임은 전체를 다시 그림 (창 노출/크기 변경, 다른 화면을 그린 뒤 등)
+void dirty_rect_invalidate(DirtyRectTracker *tracker);
+
+// 프레임 기록 시작 (이전 프레임 기록은 버림)
+void dirty_rect_begin_frame(DirtyRectTracker *tracker);
+
+// 그리기 호출 기록 (현재 렌더러의 그리기 색/블렌드 모드, 복사는 텍스처 색/알파 변조와 블렌드 모드를 대신 저장). 항상 0 반환.
+int dirty_rect_record_clear(DirtyRectTracker *tracker, SDL_Renderer *renderer);
+int dirty_rect_record_copy(DirtyRectTracker *tracker, SDL_Renderer *renderer,
+                           SDL_Texture *texture, const SDL_Rect *src, const SDL_Rect *dst);
+int dirty_rect_record_fill(DirtyRectTracker *tracker, SDL_Renderer *renderer, const SDL_Rect *rect);
+int dirty_rect_record_fills(DirtyRectTracker *tracker, SDL_Renderer *renderer, const SDL_Rect *rects, int count);
+int dirty_rect_record_outline(DirtyRectTracker *tracker, SDL_Renderer *renderer, const SDL_Rect *rect);
+int dirty_rect_record_line(DirtyRectTracker *tracker, SDL_Renderer *renderer, int x1, int y1, int x2, int y2);
+int dirty_rect_record_lines(DirtyRectTracker *tracker, SDL_Renderer *renderer, const SDL_Point *points, int count);
+
+// 달라진 영역만 다시 그려 창에 올림. 올린 사각형 수(정적인 장면이면 0), 실패 시 -1.
+// - out_pixels: 다시 그린 픽셀 수 (NULL 허용)
+int dirty_rect_present(DirtyRectTracker *tracker, SDL_Renderer *renderer, SDL_Window *window, long *out_pixels);
+
+#endif // DIRTY_RECT_H
@@ -0,0 +1,58 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+// 게임 루프 프레임 페이서
+// - 대기 방법은 하나만 사용: vsync가 실제로 동작하면 화면 표시(vsync)에만 맡기고,
+//   아니면 절대 마감 시각까지 clock_nanosleep, 무제한 모드면 기다리지 않음
+// - vsync가 켜져 있어도 드라이버/컴포지터가 무시할 수 있으므로 처음 몇 프레임의 간격으로 판별
+
+typedef enum
+{
+    FRAME_PACER_CALIBRATING = 0, // vsync 동작 여부 측정 중 (기다리지 않음)
+    FRAME_PACER_VSYNC,           // 화면 표시가 주사율에 맞춰 기다림
+    FRAME_PACER_SLEEP,           // 목표 주기의 절대 마감 시각까지 잠
+    FRAME_PACER_UNCAPPED         // 기다리지 않음 (벤치마크용)
+} FramePacerMode;
+
+typedef struct
+{
+    double fps_cap; // 0 이하면 화면 주사율
+    int uncapped;   // 1이면 제한 없음
+} FramePacerConfig;
+
+typedef struct
+{
+    FramePacerMode mode;
+    double refresh_hz;             // 창이 있는 디스플레이 주사율
+    double target_hz;              // 목표 프레임 주기 (무제한이면 0)
+    unsigned long frames;          // 측정한 프레임 수
+    unsigned long long_frames;     // 목표 간격의 1.5배를 넘긴 프레임 수
+    double error_avg_ms;           // |실제 간격 - 목표 간격|의 지수 이동 평균
+    double error_max_ms;           // 위 오차의 최대값
+    double interval_avg_ms;        // 실제 프레임 간격의 지수 이동 평균
+} FramePacerStats;
+
+typedef struct
+{
+    FramePacerStats stats;
+    long long period_ns;           // 목표 간격 (무제한이면 0)
+    long long next_deadline_ns;    // SLEEP 모드의 다음 마감 시각
+    long long last_frame_ns;       // 직전 frame_pacer_end_frame 시각 (0이면 없음)
+    int vsync_on;                  // 렌더러가 vsync로 표시하는지
+    int uncapped;                  // vsync가 안 먹으면 SLEEP 대신 UNCAPPED로
+    double calibration_ms[32];
+    int calibration_count;
+} FramePacer;
+
+// refresh_hz: 디스플레이 주사율(모르면 0 → 60으로 가정), vsync_on: 렌더러가 vsync 표시 중인지
+void frame_pacer_init(FramePacer *pacer, const FramePacerConfig *config, double refresh_hz, int vsync_on);
+
+// 스테이지 시작 등 루프가 멈췄다가 다시 돌 때 호출 (멈춘 시간을 간격으로 세지 않음)
+void frame_pacer_restart(FramePacer *pacer);
+
+// 화면 표시 직후 매 프레임 호출: 필요하면 다음 마감까지 잠들고 통계 갱신
+void frame_pacer_end_frame(FramePacer *pacer);
+
+const char *frame_pacer_mode_name(FramePacerMode mode);
+
+#endif // FRAME_PACER_H
@@ -1,6 +1,8 @@
 #ifndef GAME_H // game.h 중복 include 방지용 include guard 시작
 #define GAME_H
 
+#include "../include/rng.h"
+
 // 게임 상수
 // - 좌표: 타일 단위 + 서브픽셀 단위
 // - 타일 -> 월드: tile * SUBPIXELS_PER_TILE
@@ -13,6 +15,7 @@
 #define PLAYER_MOVE_STEP_SUBPIXELS 2 // 입력 1회당 목표 이동량(서브픽셀)
 
 #define CONSTANT_PROJECTILE_RANGE 10 // 투사체 사거리(타일 단위)
+#define PROJECTILE_SPEED_TILES_PER_SEC 50.0 // 투사체 속도 (기본 50Hz 틱에서 틱당 1타일이던 속도)
 #define SUPPLY_REFILL_AMOUNT 5       // 탄약 보충 아이템 1회당 증가량
 
 #define MAX_OBSTACLES 64         // 스테이지당 최대 장애물 수
@@ -22,6 +25,9 @@
 #define MAX_PROFESSOR_BULLETS 32 // 교수 탄환 최대 수
 #define MAX_PASSABLE_TILES (MAX_X * MAX_Y)
 
+struct Pvs; // pvs.h
+struct MoveField; // move_field.h
+
 // 아이템 종류
 typedef enum
 {
@@ -42,9 +48,11 @@ typedef struct
 typedef struct
 {
     int world_x, world_y;  // 현재 위치 (서브픽셀)
+    int prev_world_x, prev_world_y; // 직전 틱 위치 (렌더 보간용)
     int dir_x, dir_y;      // 이동 방향 단위 벡터 (-1,0,1)
     int active;            // 1: 살아 있는 투사체, 0: 소멸
-    int distance_traveled; // 이동 거리 기억
+    int tiles_traveled;    // 발사 칸에서 나와 들어간 타일 수 (사거리 판정)
+    double move_remainder; // 정수 서브픽셀로 옮기고 남은 이동량 (다음 틱에 이어서)
 } Projectile;
 
 // 플레이어가 바라보는 방향
@@ -70,6 +78,7 @@ typedef enum
 typedef struct
 {
     int world_x, world_y;               // SUBPIXELS_PER_TILE 기준 세분화 좌표
+    int prev_world_x, prev_world_y;     // 직전 시뮬레이션 틱 위치 (렌더 보간용)
     int target_world_x, target_world_y; // 목표 도달 검사 좌표
     double move_speed;                  // 초당 이동하는 서브픽셀 수 (현재 배율 적용치)
     double base_move_speed;             // 스테이지 난이도 기반 기본 속도
@@ -108,6 +117,7 @@ typedef struct // Obstacle 구조체
     int active;        // 1: 활성, 0: 비활성(죽은 상태)
 
     int world_x, world_y; // 서브픽셀 좌표
+    int prev_world_x, prev_world_y; // 직전 틱 위치 (렌더 보간용)
     int target_world_x, target_world_y;
     double move_speed;       // 초당 이동할 서브픽셀 (선형형에 사용)
     double move_accumulator; // 남은 이동량(서브픽셀)
@@ -144,10 +154,29 @@ typedef struct
     short y;
 } TileCoord;
 
+// 충돌 판정 전용 SoA 사본 (hot/cold 분리, hazard.h)
+// - 중심 좌표(서브픽셀)만 촘촘히 모아 플레이어 상자 판정을 SIMD로 처리
+// - 비활성/판정 제외 슬롯은 HAZARD_INACTIVE_COORD로 채워 마스크 없이 항상 불일치
+typedef struct
+{
+    _Alignas(16) int obstacle_cx[MAX_OBSTACLES];
+    _Alignas(16) int obstacle_cy[MAX_OBSTACLES];
+    unsigned char obstacle_fatal[MAX_OBSTACLES]; // 1: 교수 (쉴드 무시)
+    int obstacle_count;                          // 판정할 앞쪽 슬롯 수 (4의 배수로 올림)
+
+    _Alignas(16) int clone_cx[MAX_PROFESSOR_CLONES];
+    _Alignas(16) int clone_cy[MAX_PROFESSOR_CLONES];
+
+    _Alignas(16) int bullet_cx[MAX_PROFESSOR_BULLETS];
+    _Alignas(16) int bullet_cy[MAX_PROFESSOR_BULLETS];
+} HazardSoA;
+
 typedef struct
 {
     double world_x;       // 타일 기준 좌상단 좌표
     double world_y;
+    double prev_world_x;  // 직전 틱 위치 (렌더 보간용)
+    double prev_world_y;
     double vel_x;         // 타일/초 단위 속도
     double vel_y;
     double remaining_time;
@@ -194,9 +223,19 @@ typedef struct
     double difficulty_player_speed; // 플레이어 이동 속도 (타일당 초)
     int remaining_ammo;             // 게임당 발사 가능한 투사체 수 제한
 
+    double sim_time; // 스테이지 시작 후 진행된 시뮬레이션 시간(초, 고정 틱 누적)
+
     int boss_exists;
     int boss_defeated;
 
+    Rng rng;                     // 스테이지 전용 난수 (시뮬레이션 스레드만 사용)
+    unsigned long long rng_seed; // 이번 로드에 쓴 시드 (재현용)
+
+    HazardSoA hazards; // 장애물/분신/탄환 충돌 판정용 SoA 사본 (시뮬레이션 스레드가 쓰기 지점마다 동기화)
+
+    struct Pvs *pvs; // 타일별 잠재 가시 집합 (load_stage에서 생성, unload_stage에서 해제)
+    struct MoveField *move_field; // 통과 가능 타일 비트맵 (플레이어 이동 판정용, 생성/해제는 pvs와 같음)
+
 } Stage;
 
 // 타일 판정(벽/통과불가)
@@ -0,0 +1,50 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+// 폰트(글꼴 + 크기)별 글리프 아틀라스 (렌더 스레드 전용)
+// - 처음 보는 글자만 흰색으로 한 번 래스터화해 아틀라스 페이지에 붙이고, 이후 문자열은 페이지 조각(쿼드)으로만 그림
+// - 글자마다 한 글자 문자열로 렌더링하므로 쿼드 높이는 모두 폰트 높이, 기준선 위치도 문자열 렌더링과 같음
+// - 색은 그릴 때 정점 색/텍스처 색 변조로 입힘
+// - 자리를 비우는 일은 없음 (페이지가 모두 차면 새 글자는 그리지 않음)
+
+#define GLYPH_ATLAS_PAGE_SIZE 512
+#define GLYPH_ATLAS_MAX_PAGES 8
+#define GLYPH_ATLAS_MAX_GLYPHS 2048 // 해시 표 크기 (2의 거듭제곱)
+
+typedef struct GlyphAtlas GlyphAtlas;
+
+typedef struct
+{
+    SDL_Texture *texture; // 아틀라스 페이지
+    SDL_Rect src;
+    SDL_Rect dst;
+} GlyphQuad;
+
+typedef struct
+{
+    int glyphs;      // 캐시된 글자 수
+    int pages;       // 만든 페이지 수
+    int rasterized;  // 지금까지 래스터화한 횟수 (준비가 끝나면 더 늘지 않아야 함)
+    int missing;     // 폰트에 없거나 자리가 없어 못 그린 글자 수
+} GlyphAtlasStats;
+
+GlyphAtlas *glyph_atlas_create(SDL_Renderer *renderer, TTF_Font *font);
+void glyph_atlas_destroy(GlyphAtlas *atlas);
+
+// (x, y)를 왼쪽 위로 문자열을 배치해 쿼드를 채움. 채운 쿼드 수 반환 (max_quads를 넘는 글자는 버림)
+// - out_w: 문자열 폭 (NULL 허용)
+int glyph_atlas_layout(GlyphAtlas *atlas, const char *utf8, int x, int y, GlyphQuad *quads, int max_quads, int *out_w);
+
+// 문자열 크기 (필요하면 글자를 래스터화함)
+void glyph_atlas_measure(GlyphAtlas *atlas, const char *utf8, int *out_w, int *out_h);
+
+// 미리 래스터화 (정적 문자열, 숫자 등)
+void glyph_atlas_warm(GlyphAtlas *atlas, const char *utf8);
+
+int glyph_atlas_line_height(const GlyphAtlas *atlas);
+void glyph_atlas_get_stats(const GlyphAtlas *atlas, GlyphAtlasStats *out);
+
+#endif // GLYPH_ATLAS_H
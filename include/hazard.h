@@ -0,0 +1,33 @@
+#ifndef HAZARD_H
+#define HAZARD_H
+
+#include <stdint.h>
+
+#include "../include/game.h"
+
+// 충돌 판정용 SoA (Stage.hazards)
+// - stage->obstacles / professor_clones / professor_bullets를 바꾸는 곳에서 해당 슬롯을 동기화
+// - 판정은 SSE2가 있으면 4개씩, 없으면 스칼라로 "점이 플레이어 상자 안인가"를 검사
+
+#define HAZARD_INACTIVE_COORD (-(1 << 28))
+
+// 세 배열 전체를 다시 채움 (스테이지 로드 직후 등)
+void hazard_rebuild(Stage *stage);
+
+void hazard_sync_obstacle(Stage *stage, int index);
+
+// 장애물 전체 + 판정 범위(obstacle_count) 갱신 (장애물 이동 커밋 후)
+void hazard_sync_obstacles(Stage *stage);
+
+void hazard_sync_clone(Stage *stage, int index);
+
+void hazard_sync_bullet(Stage *stage, int index);
+
+// 중심점이 플레이어 상자 안에 있는 슬롯 비트마스크 (비트 i = 슬롯 i)
+uint64_t hazard_obstacle_hits(const Stage *stage, const Player *player);
+
+uint64_t hazard_clone_hits(const Stage *stage, const Player *player);
+
+uint64_t hazard_bullet_hits(const Stage *stage, const Player *player);
+
+#endif // HAZARD_H
@@ -8,10 +8,22 @@ void init_input(void);
 
 void restore_input(void);
 
+// 문자 키가 아닌 기능 키 (read_input 반환값)
+#define INPUT_KEY_TOGGLE_PERF_OVERLAY 0x100 // F3: 성능 오버레이
+
 int read_input(void);
 
 int poll_input(void); 
 
+// 메뉴 화면용 이벤트 대기 (SDL_WaitEventTimeout)
+// - 키가 눌리면 매핑된 키, 시간 초과/기타 이벤트면 -1
+// - 창 노출/복원/크기 변경이 있었으면 *needs_redraw를 1로 설정
+int wait_input(int timeout_ms, int *needs_redraw);
+
+// 창이 숨겨졌거나(최소화 포함) 포커스를 잃었으면 1 (저전력 대기 판단용)
+int input_window_is_idle(void);
+int input_window_is_hidden(void);
+
 int current_direction_key(void);
 
 #endif // INPUT_H
@@ -0,0 +1,28 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+// 작은 작업 훔치기(work-stealing) 잡 시스템
+// - 워커마다 Chase-Lev 덱 하나. 주인은 아래쪽에서 push/pop, 다른 워커는 위쪽에서 훔침
+// - parallel_for는 범위를 반씩 쪼개 자기 덱에 넣고, 쉬는 워커가 훔쳐 가서 다시 쪼갬
+// - parallel_for를 부른 스레드가 워커 0 역할을 하며 끝날 때까지 같이 일함
+// - parallel_for는 한 번에 한 스레드(시뮬레이션 스레드)에서만 호출
+
+#define JOB_MAX_WORKERS 8
+
+// 범위 [begin, end) 처리 함수. worker: 0 ~ job_system_worker_count()-1 (워커별 scratch 인덱스)
+typedef void (*JobRangeFunc)(void *ctx, int begin, int end, int worker);
+
+// num_threads: 호출 스레드를 포함한 전체 워커 수 (0이면 온라인 코어 수, 최대 JOB_MAX_WORKERS)
+int job_system_init(int num_threads);
+
+void job_system_shutdown(void);
+
+// 실행 중이면 워커 수를 바꿔 다시 시작 (벤치마크용)
+int job_system_restart(int num_threads);
+
+int job_system_worker_count(void);
+
+// [0, count)를 grain 크기 이하 조각으로 나눠 병렬 실행. 모든 조각이 끝나야 반환
+void job_system_parallel_for(int count, int grain, JobRangeFunc fn, void *ctx);
+
+#endif // JOB_SYSTEM_H
@@ -0,0 +1,66 @@
+#ifndef LOCK_STATS_H
+#define LOCK_STATS_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// 경합 통계를 모으는 뮤텍스
+// - 잠금 호출 지점(site)별로 획득 횟수, 경합 횟수, 대기/점유 시간 합계·최대·히스토그램 기록
+// - 통계 갱신은 락을 잡은 스레드만 하므로 추가 동기화 없음 (읽기용으로 relaxed 원자 변수 사용)
+// - 히스토그램 칸은 4배 간격: <1us, <4us, <16us, ... , 마지막 칸은 그 이상
+// - 정의하는 쪽에서 mutex/name과 쓰는 지점의 sites[i].name을 정적으로 초기화 (이름 없는 지점은 보고 생략)
+
+#define LOCK_STATS_MAX_SITES 4
+#define LOCK_STATS_BUCKETS 10
+
+typedef struct
+{
+    const char *name;
+    atomic_ulong acquisitions;
+    atomic_ulong contended; // trylock 실패 후 기다린 횟수
+    atomic_ulong wait_total_ns;
+    atomic_ulong wait_max_ns;
+    atomic_ulong hold_total_ns;
+    atomic_ulong hold_max_ns;
+    atomic_ulong wait_hist[LOCK_STATS_BUCKETS];
+    atomic_ulong hold_hist[LOCK_STATS_BUCKETS];
+} LockSiteStats;
+
+typedef struct
+{
+    pthread_mutex_t mutex;
+    const char *name;
+    LockSiteStats sites[LOCK_STATS_MAX_SITES];
+    int holder_site;       // 락 보유 중에만 유효
+    uint64_t hold_start_ns; // 락 보유 중에만 유효
+} InstrumentedMutex;
+
+// 오버레이/보고용 복사본
+typedef struct
+{
+    const char *name;
+    unsigned long acquisitions;
+    unsigned long contended;
+    double wait_avg_us;
+    double wait_max_us;
+    double hold_avg_us;
+    double hold_max_us;
+    unsigned long wait_hist[LOCK_STATS_BUCKETS];
+    unsigned long hold_hist[LOCK_STATS_BUCKETS];
+} LockSiteSnapshot;
+
+void instrumented_lock(InstrumentedMutex *m, int site);
+
+void instrumented_unlock(InstrumentedMutex *m);
+
+void instrumented_mutex_snapshot(const InstrumentedMutex *m, int site, LockSiteSnapshot *out);
+
+// 히스토그램 칸 경계 (칸 i의 상한, 마이크로초)
+double lock_stats_bucket_limit_us(int bucket);
+
+// 전체 지점 통계 표 출력 (종료 시)
+void instrumented_mutex_report(const InstrumentedMutex *m, FILE *out);
+
+#endif // LOCK_STATS_H
@@ -0,0 +1,49 @@
+#ifndef LOG_H
+#define LOG_H
+
+// 비동기 로그
+// - 어느 스레드에서든 log_write는 고정 크기 링에 메시지를 넣기만 함 (락/시스템 콜 없음)
+// - 출력(printf/fflush)은 백그라운드 드레인 스레드나 log_flush를 부른 스레드가 몰아서 처리
+// - 링이 가득 차면 메시지를 버리고 개수만 세어 다음 드레인 때 알림
+// - LOG_DEBUG는 LOG_ENABLE_DEBUG를 정의해 빌드할 때만 남음 (make LOG_DEBUG=1)
+
+typedef enum
+{
+    LOG_LEVEL_DEBUG = 0,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_WARN,
+    LOG_LEVEL_ERROR
+} LogLevel;
+
+typedef enum
+{
+    LOG_CAT_GAME = 0, // 플레이어에게 보여주는 진행 메시지
+    LOG_CAT_SIM,      // 시뮬레이션 스레드
+    LOG_CAT_PATTERN,  // 교수 패턴
+    LOG_CAT_STAGE,    // 스테이지 로드/해제
+    LOG_CAT_COUNT
+} LogCategory;
+
+// 드레인 스레드 시작 (시작 전에는 log_write가 바로 출력)
+int log_init(void);
+
+// 남은 메시지를 모두 출력하고 드레인 스레드 종료
+void log_shutdown(void);
+
+// 지금까지 쌓인 메시지를 호출 스레드에서 바로 출력 (직접 printf하기 전에 순서 맞추기용)
+void log_flush(void);
+
+void log_write(LogLevel level, LogCategory category, const char *fmt, ...)
+    __attribute__((format(printf, 3, 4)));
+
+#define LOG_INFO(category, ...) log_write(LOG_LEVEL_INFO, (category), __VA_ARGS__)
+#define LOG_WARN(category, ...) log_write(LOG_LEVEL_WARN, (category), __VA_ARGS__)
+#define LOG_ERROR(category, ...) log_write(LOG_LEVEL_ERROR, (category), __VA_ARGS__)
+
+#if defined(LOG_ENABLE_DEBUG)
+#define LOG_DEBUG(category, ...) log_write(LOG_LEVEL_DEBUG, (category), __VA_ARGS__)
+#else
+#define LOG_DEBUG(category, ...) ((void)0)
+#endif
+
+#endif // LOG_H
@@ -0,0 +1,25 @@
+#ifndef MOVE_FIELD_H
+#define MOVE_FIELD_H
+
+#include "../include/game.h"
+
+// 플레이어 이동용 통과 가능 타일 비트맵
+// - 타일마다 1비트: 1이면 지나갈 수 있음, 0이면 막힘 (벽/통과불가 문자/살아 있는 깨지는 벽)
+// - 이동 판정이 맵 문자 + 깨지는 벽 목록을 매번 훑지 않고 비트 하나만 보도록 미리 계산
+// - 깨지는 벽이 부서지면 그 타일 비트만 갱신
+// - 읽기/쓰기 모두 시뮬레이션 스레드에서만 함
+
+struct MoveField;
+
+// stage의 맵/깨지는 벽으로 비트맵 생성 (실패 시 NULL)
+struct MoveField *move_field_build(const Stage *stage);
+
+void move_field_destroy(struct MoveField *field);
+
+// (tile_x, tile_y)를 지나갈 수 있으면 1 (맵 밖은 0)
+int move_field_is_open(const struct MoveField *field, int tile_x, int tile_y);
+
+// (tile_x, tile_y)의 통과 여부가 바뀌었을 때 해당 비트만 갱신
+void move_field_update_tile(struct MoveField *field, const Stage *stage, int tile_x, int tile_y);
+
+#endif // MOVE_FIELD_H
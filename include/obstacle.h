@@ -3,10 +3,43 @@
 
 #include <pthread.h>   
 #include "../include/game.h"       
+#include "../include/lock_stats.h"
 #include "../include/professor_pattern.h"
 
 
-extern pthread_mutex_t g_stage_mutex;
+// 장애물 스레드 고정 틱 주기 (Hz)
+#define OBSTACLE_TICK_HZ_DEFAULT 50
+#define OBSTACLE_TICK_HZ_MIN 10
+#define OBSTACLE_TICK_HZ_MAX 1000
+#define OBSTACLE_MAX_CATCHUP_STEPS 5 // 늦었을 때 한 번에 따라잡는 최대 틱 수
+
+// 장애물 스레드 틱 통계 (프로파일러/디버그 출력용)
+typedef struct
+{
+    int tick_hz;                    // 설정된 틱 주기
+    unsigned long ticks;            // 실행한 시뮬레이션 스텝 수
+    unsigned long wakeups;          // 스레드가 깨어난 횟수
+    unsigned long missed_deadlines; // 다음 마감 시각까지 넘겨서 깨어난 틱 수
+    unsigned long dropped_ticks;    // 따라잡기 한도를 넘어 버린 틱 수
+    double jitter_avg_ms;           // 마감 대비 기상 지연 평균
+    double jitter_max_ms;           // 마감 대비 기상 지연 최대
+    double measured_hz;             // 실제 측정된 틱 주기
+} ObstacleTickStats;
+
+// g_stage_mutex 잠금 지점 (지점별 경합 통계)
+// - 렌더/메인 루프는 world_state 스냅샷만 읽으므로 이 락을 잡지 않음 (지금은 경합이 생길 수 없음)
+// - 메인 스레드와 실제로 만나는 곳은 seqlock 다시 읽기와 SPSC 큐 가득 참이라 각 모듈에서 따로 셈
+typedef enum
+{
+    STAGE_LOCK_SITE_TICK_START = 0, // 장애물 스레드 시작 시 틱 시각 발행
+    STAGE_LOCK_SITE_SIM_TICK,       // 시뮬레이션 스텝 + 스냅샷 발행
+    STAGE_LOCK_SITE_COUNT
+} StageLockSite;
+
+extern InstrumentedMutex g_stage_mutex;
+
+// g_stage_mutex 지점별 통계 + seqlock/큐 통계 출력 (프로그램 종료 시)
+void report_stage_lock_stats(void);
 
 void set_obstacle_player_ref( Player *p);
 
@@ -14,6 +47,13 @@ int start_obstacle_thread(Stage *stage);
 
 void stop_obstacle_thread(void);
 
+// 틱 주기 설정 (다음 start_obstacle_thread부터 적용)
+void set_obstacle_tick_rate(int hz);
+
+int get_obstacle_tick_rate(void);
+
+void get_obstacle_tick_stats(ObstacleTickStats *out);
+
 
 void move_obstacles(Stage *stage, double delta_time); 
 
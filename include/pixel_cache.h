@@ -0,0 +1,23 @@
+#ifndef PIXEL_CACHE_H
+#define PIXEL_CACHE_H
+
+#include "../include/asset_loader.h"
+
+// 디코딩한 RGBA 픽셀을 디스크에 저장해 두고 다음 실행부터 PNG 압축 해제 없이 mmap으로 읽음
+// - 위치: assets/ 옆의 .asset_cache/ (파일 이름은 원본 경로 해시)
+// - 원본 PNG의 수정 시각/크기가 헤더와 다르면 무효 → 다시 디코딩해서 덮어씀
+// - 환경 변수 GAME_ASSET_CACHE=0이면 끔
+// - 여러 디코딩 스레드에서 동시에 호출해도 됨
+
+#define PIXEL_CACHE_DIR ".asset_cache"
+
+// 캐시에 맞는 항목이 있으면 out을 mmap 결과로 채우고 1, 없으면 0
+int pixel_cache_load(const char *path, AssetImage *out);
+
+// 디코딩 결과 저장 (실패해도 게임에는 영향 없음)
+void pixel_cache_store(const char *path, const AssetImage *image);
+
+// 이번 실행의 적중/미적중 수
+void pixel_cache_get_stats(int *hits, int *misses);
+
+#endif // PIXEL_CACHE_H
@@ -6,6 +6,8 @@
 
 void fire_projectile(Stage *stage, const Player *player);
 
-void move_projectiles(Stage *stage);
+// dt초만큼 이동 (속도는 틱 주기와 무관하게 PROJECTILE_SPEED_TILES_PER_SEC)
+// - 이번 틱에 지나가는 타일을 모두 훑어(DDA) 벽/장애물 판정하므로 한 번에 여러 타일을 가도 통과하지 않음
+void move_projectiles(Stage *stage, double dt);
 
 #endif 
\ No newline at end of file
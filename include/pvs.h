@@ -0,0 +1,36 @@
+#ifndef PVS_H
+#define PVS_H
+
+#include <stdint.h>
+
+#include "../include/game.h"
+
+// 타일별 잠재 가시 집합(PVS)
+// - 스테이지 로드 시 모든 통과 가능 타일에서 주변 박스(±PVS_RADIUS_X, ±PVS_RADIUS_Y) 안의
+//   타일이 보이는지 Bresenham 시선으로 미리 계산해 비트 행으로 저장
+// - 박스는 화면 전체(카메라가 맵 가장자리에 붙어도)와 교수 시야를 덮는 크기
+// - 불투명: '#', '@', 살아 있는 깨지는 벽. 벽이 깨지면 해당 부분만 다시 계산
+// - 쓰기는 시뮬레이션 스레드만, 읽기는 렌더 스레드도 함 (비트 행은 relaxed 원자 접근)
+
+#define PVS_RADIUS_X 26
+#define PVS_RADIUS_Y 15
+#define PVS_ROWS (PVS_RADIUS_Y * 2 + 1)
+
+struct Pvs;
+
+// stage의 맵/깨지는 벽으로 PVS 생성 (실패 시 NULL)
+struct Pvs *pvs_build(const Stage *stage);
+
+void pvs_destroy(struct Pvs *pvs);
+
+// (from_x, from_y) 타일에서 (to_x, to_y) 타일이 보이는지. 박스 밖이면 직접 시선 계산
+int pvs_can_see(const struct Pvs *pvs, int from_x, int from_y, int to_x, int to_y);
+
+// (center_x, center_y) 주변 박스의 가시 여부를 visibility[y][x]에 채움 (박스 밖은 0)
+void pvs_fill_visibility(const struct Pvs *pvs, int center_x, int center_y,
+                         unsigned char visibility[MAX_Y][MAX_X]);
+
+// 깨지는 벽이 사라져 (tile_x, tile_y)가 투명해졌을 때 영향받는 비트만 갱신
+void pvs_open_tile(struct Pvs *pvs, int tile_x, int tile_y);
+
+#endif // PVS_H
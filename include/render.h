@@ -1,7 +1,10 @@
 #ifndef RENDER_H
 #define RENDER_H
 
-#include "../include/game.h"   
+#include <SDL2/SDL.h>
+
+#include "../include/game.h"
+#include "../include/lock_stats.h"
 
 // SDL 기반 렌더러 초기화/해제 함수.
 // - init_renderer: SDL, 텍스처 로드, 윈도우 생성
@@ -9,6 +12,25 @@
 int init_renderer(void);
 void shutdown_renderer(void);
 
+// 창/디스플레이 없이 WINDOW_WIDTH x WINDOW_HEIGHT ARGB8888 표면에 그리는 소프트웨어 렌더러로 초기화 (렌더 벤치마크용)
+// - 이후 render()/메뉴 화면 함수는 그대로 쓰고, 한 프레임이 끝나면 결과가 render_offscreen_surface()에 있음
+// - 해제는 shutdown_renderer
+int init_offscreen_renderer(void);
+SDL_Surface *render_offscreen_surface(void); // 창 모드면 NULL
+
+// 플레이 영상 녹화 시작 (capture.h). 렌더러 출력 크기로 녹화하고 shutdown_renderer에서 끝냄. 실패하면 -1
+int render_start_capture(const char *path, int fps);
+
+// 비동기 에셋 로딩 (init_renderer는 PNG 디코딩을 작업 풀에 넣기만 하고 바로 돌아감)
+// - render_pump_assets: 디코딩이 끝난 이미지를 텍스처로 만듦 (메뉴 대기 루프에서 호출). 새로 만든 수 반환
+// - render_assets_pending: 아직 텍스처가 안 된 에셋 수
+// - render_finish_assets: 남은 에셋을 모두 기다림. 필수 텍스처가 없으면 -1 (게임 시작 전에 호출)
+// - render_prepare_stage: 해당 스테이지 교수 텍스처를 로드하고 다음 스테이지 것을 미리 디코딩
+int render_pump_assets(void);
+int render_assets_pending(void);
+int render_finish_assets(void);
+void render_prepare_stage(int stage_id);
+
 // 전체 게임 화면을 그려주는 함수.
 // - 인자 stage: 현재 스테이지 상태 (맵, 장애물 위치 등)
 // - 인자 player: 현재 플레이어 상태 (위치, alive 여부)
@@ -16,8 +38,55 @@ void shutdown_renderer(void);
 // - 인자 current_stage: 현재 스테이지 번호(예: 1, 2, 3 ...)
 // - 인자 total_stages: 전체 스테이지 수 (예: 5 스테이지 중 몇 번째인지 표시).
 
+// 장애물/교수 탄환 보간 비율 설정 (0: 직전 틱 위치, 1: 현재 틱 위치).
+// - 시뮬레이션 틱이 화면 주사율보다 낮아도 움직임이 부드럽게 보이도록 render() 전에 호출.
+void render_set_tick_alpha(double alpha);
+
+// vsync 표시 요청 (init_renderer 전에 호출하면 생성 시 반영, 이후에는 SDL 2.0.18 이상에서만 바뀜).
+// 실제로 vsync 표시 중인지 반환.
+int render_set_vsync(int enabled);
+int render_vsync_active(void);
+
+// 창이 있는 디스플레이 주사율 (모르면 0)
+double render_display_refresh_hz(void);
+
+// 동적 해상도가 기준으로 삼는 프레임 예산 (기본 16.7ms, 프레임 페이서 목표 주기로 맞춤)
+void render_set_frame_budget_ms(double budget_ms);
+
+// 동적 해상도 켜기/끄기 (기본 켜짐). 켜면 프레임 시간이 예산을 넘을 때 장면을 75%/50%로 줄여 그린 뒤 확대.
+void render_set_dynamic_resolution(int enabled);
+
 void render(const Stage *stage, const Player *player, double elapsed_time, int current_stage, int total_stages);
 
+// F3 성능 오버레이에 표시할 외부 지표 (렌더러가 obstacle/sound 모듈을 직접 알지 않도록 main이 채워서 넘김).
+// - audio_voices: 재생 중인 효과음 보이스 수, 알 수 없으면 -1
+// - stage_lock/seqlock_*/queue_*: 스레드 간 동기화 통계 (프로그램 시작부터 누적)
+typedef struct
+{
+    int tick_hz;
+    double tick_measured_hz;
+    double tick_jitter_avg_ms;
+    double tick_jitter_max_ms;
+    unsigned long tick_missed;
+    int audio_voices;
+    double stage_load_ms;
+    const char *pace_mode; // 프레임 페이서 대기 방식
+    double pace_target_hz;
+    double display_refresh_hz;
+    double pace_error_avg_ms;
+    double pace_error_max_ms;
+    unsigned long pace_long_frames;
+    LockSiteSnapshot stage_lock;   // g_stage_mutex 시뮬레이션 틱 지점
+    unsigned long seqlock_reads;
+    unsigned long seqlock_retries; // 렌더가 발행과 겹쳐 스냅샷을 다시 읽은 횟수
+    double seqlock_wait_max_us;
+    unsigned long queue_commands_dropped;
+    unsigned long queue_events_dropped;
+} RenderPerfStats;
+
+void render_set_perf_stats(const RenderPerfStats *stats);
+void render_toggle_perf_overlay(void);
+
 // 비플레이 상태 화면 렌더러.
 // - 시작 화면: 메뉴 선택 상태를 받아 오른쪽 패널에 하이라이트를 표시.
 // - 기록 화면: 최고 기록을 전달받아 텍스트 UI 렌더링.
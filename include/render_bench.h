@@ -0,0 +1,25 @@
+#ifndef RENDER_BENCH_H
+#define RENDER_BENCH_H
+
+// 창/GPU 없이 실제 render()를 돌리는 렌더 벤치마크 (디스플레이 없는 CI용)
+// - 오프스크린 소프트웨어 렌더러에 스크립트로 움직이는 플레이 세션을 그리고 프레임당 렌더 시간을 측정
+// - N프레임마다 프레임을 PNG 또는 raw 시퀀스로 저장하고, 같은 프레임의 해시를 출력해 화면 회귀를 비교
+
+typedef enum
+{
+    RENDER_DUMP_PNG = 0, // DIR/frame_000060.png ...
+    RENDER_DUMP_RAW      // DIR/frames.argb (ARGB8888 프레임을 이어 붙임)
+} RenderDumpFormat;
+
+typedef struct
+{
+    int frames;                   // 측정할 프레임 수 (워밍업 제외)
+    int sample_every;             // 저장/해시할 프레임 간격
+    const char *dump_dir;         // NULL이면 저장하지 않음
+    RenderDumpFormat dump_format;
+} RenderBenchOptions;
+
+// 스테이지 하나로 벤치마크 실행 후 SDL까지 정리. 성공하면 0
+int run_render_benchmark(int stage_id, const RenderBenchOptions *options);
+
+#endif // RENDER_BENCH_H
@@ -0,0 +1,30 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+// 스테이지 전용 난수 생성기 (xoshiro128**)
+// - 전역 rand()와 달리 상태를 Stage가 직접 들고 있어 스레드 간에 공유되지 않음
+// - 같은 시드면 같은 순서가 나오므로 스트레스 실행/벤치마크를 그대로 재현 가능
+
+typedef struct
+{
+    uint32_t s[4];
+} Rng;
+
+// 64비트 시드로 상태 초기화 (splitmix64로 펼침, 0도 사용 가능)
+void rng_seed(Rng *rng, uint64_t seed);
+
+uint32_t rng_next(Rng *rng);
+
+// [0, bound) 균등 정수 (bound <= 0이면 0)
+int rng_below(Rng *rng, int bound);
+
+// [lo, hi] 균등 정수 (양 끝 포함)
+int rng_range(Rng *rng, int lo, int hi);
+
+// [0, n)에서 서로 다른 인덱스 k개를 out에 채움 (Floyd 표본 추출, 순서는 무작위 아님)
+// 반환값: 채운 개수 (min(k, n))
+int rng_pick_distinct(Rng *rng, int n, int k, int *out);
+
+#endif // RNG_H
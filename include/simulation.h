@@ -0,0 +1,85 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "../include/game.h"
+
+// 시뮬레이션 스텝
+// - 장애물 스레드가 고정 틱마다 simulation_step 한 번 호출 (플레이어 상태의 유일한 작성자)
+// - 메인 스레드는 입력을 PlayerCommand로 넣고, 결과는 SimEvent로 돌려받음 (둘 다 SPSC 큐, 락 없음)
+
+typedef enum
+{
+    PLAYER_COMMAND_HOLD_DIRECTION = 0, // 누르고 있는 방향키 변경 (key: 'w'/'a'/'s'/'d' 또는 -1)
+    PLAYER_COMMAND_STEP,               // 방향키 입력 한 번 (key)
+    PLAYER_COMMAND_FIRE                // 투사체 발사
+} PlayerCommandType;
+
+typedef struct
+{
+    PlayerCommandType type;
+    int key;
+} PlayerCommand;
+
+typedef enum
+{
+    SIM_EVENT_BAG_ACQUIRED = 0,
+    SIM_EVENT_WALK,            // 발소리 재생 시점
+    SIM_EVENT_FIRE,            // 발사 성공
+    SIM_EVENT_FIRE_EMPTY,      // 탄약 없음
+    SIM_EVENT_ITEM_PICKED,     // item_type, value(쉴드 수/탄약 수)
+    SIM_EVENT_SCOOTER_EXPIRED,
+    SIM_EVENT_SHIELD_BLOCKED,  // source, value(남은 쉴드)
+    SIM_EVENT_STAGE_FAILED,    // source
+    SIM_EVENT_STAGE_CLEARED
+} SimEventType;
+
+typedef enum
+{
+    SIM_HAZARD_NONE = 0,
+    SIM_HAZARD_TRAP,
+    SIM_HAZARD_OBSTACLE,
+    SIM_HAZARD_BULLET
+} SimHazardSource;
+
+typedef struct
+{
+    SimEventType type;
+    SimHazardSource source;
+    ItemType item_type;
+    int value;
+    double value_f;
+} SimEvent;
+
+typedef enum
+{
+    SIM_OUTCOME_RUNNING = 0,
+    SIM_OUTCOME_FAILED,
+    SIM_OUTCOME_CLEARED
+} SimOutcome;
+
+// 메인 스레드와 시뮬레이션이 만나는 큐 통계 (프로그램 시작부터 누적)
+typedef struct
+{
+    unsigned long commands_pushed;
+    unsigned long commands_dropped; // 명령 큐가 가득 차서 넣지 못함 (입력 손실)
+    unsigned long events_dropped;   // 이벤트 큐가 가득 차서 버림 (효과음/메시지 손실)
+} SimulationQueueStats;
+
+// 새 스테이지 시작 전(장애물 스레드 시작 전) 큐/상태 초기화
+void simulation_begin_stage(void);
+
+// 메인 스레드 → 시뮬레이션. 큐가 가득 차면 0
+int simulation_push_command(const PlayerCommand *cmd);
+
+// 시뮬레이션 → 메인 스레드. 꺼낼 이벤트가 없으면 0
+int simulation_poll_event(SimEvent *out);
+
+// 스테이지 결과 (실패/클리어가 정해지면 이후 스텝은 아무것도 하지 않음)
+SimOutcome simulation_get_outcome(void);
+
+void simulation_get_queue_stats(SimulationQueueStats *out);
+
+// 고정 dt 한 스텝: 플레이어 명령 적용 → 플레이어/아이템/투사체 → 장애물/교수 탄환 → 함정/충돌/탈출 판정
+void simulation_step(Stage *stage, Player *player, double dt);
+
+#endif // SIMULATION_H
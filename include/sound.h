@@ -16,6 +16,12 @@ void init_sound_system(void);
 // 논블로킹 효과음 재생 함수
 void play_sfx_nonblocking(const char *filePath);
 
+// 1이면 효과음 요청을 무시 (벤치마크용)
+void set_sfx_muted(int muted);
+
+// 효과음 워커에서 지금 믹싱 중인 보이스 수 (워커가 없으면 -1)
+int get_active_sfx_voices(void);
+
 // TTS(텍스트 음성 변환) 기능: 주어진 텍스트를 음성으로 출력 (Blocking)
 void speak_tts_blocking(const char *text);
 
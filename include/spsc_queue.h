@@ -0,0 +1,31 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+// 단일 생산자/단일 소비자 고정 크기 링 버퍼 (락 없음)
+// - push는 생산자 스레드 하나만, pop은 소비자 스레드 하나만 호출
+// - capacity는 2의 거듭제곱, 저장 공간은 호출자가 제공 (capacity * elem_size 바이트)
+
+typedef struct
+{
+    atomic_uint head; // 소비자가 다음에 읽을 위치
+    atomic_uint tail; // 생산자가 다음에 쓸 위치
+    unsigned capacity;
+    size_t elem_size;
+    unsigned char *buffer;
+} SpscQueue;
+
+void spsc_queue_init(SpscQueue *q, void *buffer, unsigned capacity, size_t elem_size);
+
+// 가득 찼으면 0, 넣었으면 1
+int spsc_queue_push(SpscQueue *q, const void *elem);
+
+// 비었으면 0, 꺼냈으면 1
+int spsc_queue_pop(SpscQueue *q, void *out);
+
+// 소비자 쪽에서 남은 항목을 모두 버림
+void spsc_queue_clear(SpscQueue *q);
+
+#endif // SPSC_QUEUE_H
@@ -8,6 +8,15 @@
 int load_stage(Stage *stage, int stage_id);
 int get_stage_count(void);
 
+// 스테이지 난수 시드 고정 (--seed). 호출하지 않으면 로드할 때마다 새 시드
+void set_stage_rng_seed(unsigned long long seed);
+
+// load_stage가 만든 부가 데이터(PVS 등) 해제
+void unload_stage(Stage *stage);
+
+// 깨지는 벽이 부서졌을 때 호출 (시야 등 벽에 의존하는 미리 계산한 데이터 갱신)
+void stage_on_breakable_wall_destroyed(Stage *stage, int tile_x, int tile_y);
+
 
 int find_stage_id_by_filename(const char *filename);
 
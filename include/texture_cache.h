@@ -0,0 +1,46 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include <SDL2/SDL.h>
+#include <stddef.h>
+
+// 경로 기준 텍스처 캐시 (렌더 스레드 전용)
+// - 같은 파일(realpath 기준)은 한 번만 디코딩/업로드하고 참조 수로 공유
+// - 디코딩은 asset_loader 작업 풀에서, 텍스처 생성은 texture_cache_pump/wait을 부른 스레드에서
+
+#define TEXTURE_CACHE_MAX_ENTRIES 64
+
+typedef struct
+{
+    int requested;       // texture_cache_request 호출 수
+    int unique;          // 지금 살아 있는 항목 수 (서로 다른 파일)
+    int loaded;          // 그중 텍스처가 만들어진 항목 수
+    size_t texture_bytes; // 만들어진 텍스처 픽셀 메모리 합 (폭 × 높이 × 픽셀 바이트)
+} TextureCacheStats;
+
+void texture_cache_init(SDL_Renderer *renderer);
+
+// 남은 텍스처를 모두 해제
+void texture_cache_shutdown(void);
+
+// 텍스처 요청 (참조 수 + 1). 처음 보는 파일이면 디코딩 작업을 넣음. 항목 번호 반환, 실패 시 -1
+int texture_cache_request(const char *path);
+
+// 참조 수 - 1, 0이 되면 텍스처 해제
+void texture_cache_release(int entry);
+
+// 디코딩이 끝난 항목을 텍스처로 만듦. 새로 끝난 항목 수 반환
+int texture_cache_pump(void);
+
+// 아직 디코딩/생성이 안 끝난 항목인지
+int texture_cache_pending(int entry);
+
+// 끝날 때까지 기다려 텍스처 반환 (실패 시 NULL)
+SDL_Texture *texture_cache_wait(int entry);
+
+// 지금 있는 텍스처 (아직이거나 실패면 NULL)
+SDL_Texture *texture_cache_texture(int entry);
+
+void texture_cache_get_stats(TextureCacheStats *out);
+
+#endif // TEXTURE_CACHE_H
@@ -0,0 +1,37 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+// Chrome trace_event(JSON) 타임라인 기록기 - Perfetto/chrome://tracing에서 열기
+// - --trace=파일 또는 환경 변수 GAME_TRACE=파일로 켬. 꺼져 있으면 호출마다 원자 변수 하나만 확인
+// - 스레드마다 자기 버퍼에만 씀 (락 없음). 버퍼가 차면 이후 이벤트는 버리고 개수만 셈
+// - 파일은 trace_shutdown에서 한 번에 씀 (모든 기록 스레드가 멈춘 뒤 호출)
+// - name/category는 문자열 리터럴처럼 프로그램이 끝날 때까지 유효한 문자열만 넘길 것
+
+extern atomic_int g_trace_enabled;
+
+// path가 NULL/빈 문자열이면 GAME_TRACE 환경 변수 사용. 둘 다 없으면 꺼진 채로 0 반환
+int trace_init(const char *path);
+
+void trace_shutdown(void);
+
+static inline int trace_enabled(void)
+{
+    return atomic_load_explicit(&g_trace_enabled, memory_order_relaxed);
+}
+
+// 현재 스레드의 트랙 이름 (Perfetto에 표시, 내부로 복사)
+void trace_thread_name(const char *name);
+
+// 구간 시작 시각 (꺼져 있으면 0)
+uint64_t trace_begin(void);
+
+// trace_begin부터 지금까지를 완료 이벤트 하나로 기록
+void trace_end(const char *name, const char *category, uint64_t begin_ns);
+
+// 순간 이벤트 (스킬 시전 등)
+void trace_instant(const char *name, const char *category);
+
+#endif // TRACE_H
@@ -0,0 +1,44 @@
+#ifndef WORLD_STATE_H
+#define WORLD_STATE_H
+
+#include "../include/game.h"
+
+// 월드 상태 발행(seqlock)
+// - 작성자(시뮬레이션 틱)는 g_stage_mutex를 잡은 채로 world_state_publish 호출
+// - 읽는 쪽(렌더)은 락 없이 일관된 스냅샷을 복사해 감
+// - 대상: 플레이어, 장애물, 교수 분신, 교수 탄환, 아이템, 투사체, 탄약, 가방 칸 + 틱 시각(보간용)
+
+typedef struct
+{
+    unsigned long version;      // 발행 번호 (발행할 때마다 증가)
+    long long tick_time_ns;     // 마지막 틱 마감 시각 (CLOCK_MONOTONIC)
+    long long tick_period_ns;   // 틱 주기
+} WorldTickTiming;
+
+// 읽는 쪽 seqlock 통계 (렌더가 시뮬레이션 발행과 겹쳐 다시 읽은 횟수)
+typedef struct
+{
+    unsigned long reads;         // world_state_read 호출 수
+    unsigned long retried_reads; // 한 번 이상 다시 읽은 호출 수
+    unsigned long retries;       // 다시 읽은 총 횟수 (쓰는 중이었거나 복사 도중 바뀜)
+    double retry_wait_max_us;    // 다시 읽느라 더 걸린 시간 최대
+} WorldStateReadStats;
+
+// 새 스테이지 시작 시 발행 버퍼 초기화
+void world_state_reset(void);
+
+// 장애물 틱이 방금 처리한 틱의 시각/주기 기록 (다음 publish에 함께 실림)
+void world_state_set_tick_timing(long long tick_time_ns, long long tick_period_ns);
+
+// 현재 stage/player의 시뮬레이션 상태를 발행 (g_stage_mutex 보유 상태에서 호출)
+void world_state_publish(const Stage *stage, const Player *player);
+
+// 마지막으로 발행된 상태를 view/player에 덮어씀 (락 없음, 위 대상 필드만 갱신)
+void world_state_read(Stage *view, Player *player, WorldTickTiming *timing);
+
+void world_state_get_read_stats(WorldStateReadStats *out);
+
+// 스냅샷 틱 이후 다음 틱까지 진행률 (0~1, 렌더 보간용)
+double world_state_tick_alpha(const WorldTickTiming *timing);
+
+#endif // WORLD_STATE_H
@@ -0,0 +1,274 @@
+// 이미지 디코딩 작업 풀
+// - 고정 크기 작업 표 + 뮤텍스/조건 변수 하나 (작업 수가 수십 개라 이걸로 충분)
+// - 잡 시스템(job_system)은 시뮬레이션 스레드 전용 parallel_for라 여기서는 따로 스레드를 둠
+
+#include <SDL2/SDL_image.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "../include/asset_loader.h"
+#include "../include/pixel_cache.h"
+#include "../include/trace.h"
+
+typedef enum
+{
+    ASSET_JOB_FREE = 0,
+    ASSET_JOB_QUEUED,
+    ASSET_JOB_DECODING,
+    ASSET_JOB_DONE
+} AssetJobState;
+
+typedef struct
+{
+    AssetJobState state;
+    unsigned long seq; // 넣은 순서 (작은 것부터 처리)
+    char path[256];
+    AssetImage image;
+} AssetJob;
+
+static AssetJob g_jobs[ASSET_LOADER_MAX_JOBS];
+static unsigned long g_next_seq = 0;
+static pthread_mutex_t g_jobs_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_job_queued = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t g_job_done = PTHREAD_COND_INITIALIZER;
+static pthread_t g_threads[ASSET_LOADER_MAX_THREADS];
+static int g_thread_count = 0;
+static int g_stopping = 0;
+
+int asset_image_load(const char *path, AssetImage *out)
+{
+    memset(out, 0, sizeof(*out));
+
+    uint64_t trace_cached = trace_begin();
+    if (pixel_cache_load(path, out))
+    {
+        trace_end("map cached pixels", "asset", trace_cached);
+        return 0;
+    }
+
+    uint64_t trace_decode = trace_begin();
+    SDL_Surface *loaded = IMG_Load(path);
+    if (!loaded)
+    {
+        fprintf(stderr, "IMG_Load failed for %s: %s\n", path, IMG_GetError());
+        return -1;
+    }
+    // 텍스처 업로드와 캐시 파일이 한 가지 형식만 다루도록 RGBA32로 맞춤 (컬러키는 알파로 바뀜)
+    SDL_Surface *rgba = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (!rgba)
+    {
+        fprintf(stderr, "SDL_ConvertSurfaceFormat failed for %s: %s\n", path, SDL_GetError());
+        return -1;
+    }
+    trace_end("decode image", "asset", trace_decode);
+
+    out->surface = rgba;
+    out->pixels = rgba->pixels;
+    out->w = rgba->w;
+    out->h = rgba->h;
+    out->pitch = rgba->pitch;
+    pixel_cache_store(path, out);
+    return 0;
+}
+
+void asset_image_free(AssetImage *image)
+{
+    if (!image)
+    {
+        return;
+    }
+    if (image->surface)
+    {
+        SDL_FreeSurface(image->surface);
+    }
+    if (image->mapping)
+    {
+        munmap(image->mapping, image->mapping_size);
+    }
+    memset(image, 0, sizeof(*image));
+}
+
+// 가장 먼저 들어온 대기 작업 (g_jobs_mutex 잡은 상태)
+static int oldest_queued_job_locked(void)
+{
+    int found = -1;
+    for (int i = 0; i < ASSET_LOADER_MAX_JOBS; ++i)
+    {
+        if (g_jobs[i].state == ASSET_JOB_QUEUED && (found < 0 || g_jobs[i].seq < g_jobs[found].seq))
+        {
+            found = i;
+        }
+    }
+    return found;
+}
+
+// 작업 하나를 잠금 밖에서 디코딩하고 결과 기록 (g_jobs_mutex 잡은 상태로 들어와서 잡은 상태로 나감)
+static void run_job_locked(int index)
+{
+    AssetJob *job = &g_jobs[index];
+    job->state = ASSET_JOB_DECODING;
+    char path[sizeof(job->path)];
+    memcpy(path, job->path, sizeof(path));
+
+    pthread_mutex_unlock(&g_jobs_mutex);
+    AssetImage image;
+    asset_image_load(path, &image);
+    pthread_mutex_lock(&g_jobs_mutex);
+
+    job->image = image;
+    job->state = ASSET_JOB_DONE;
+    pthread_cond_broadcast(&g_job_done);
+}
+
+static void *asset_worker_main(void *arg)
+{
+    (void)arg;
+    trace_thread_name("asset decode");
+    pthread_mutex_lock(&g_jobs_mutex);
+    while (!g_stopping)
+    {
+        int index = oldest_queued_job_locked();
+        if (index < 0)
+        {
+            pthread_cond_wait(&g_job_queued, &g_jobs_mutex);
+            continue;
+        }
+        run_job_locked(index);
+    }
+    pthread_mutex_unlock(&g_jobs_mutex);
+    return NULL;
+}
+
+int asset_loader_init(int threads)
+{
+    if (g_thread_count > 0)
+    {
+        return 0;
+    }
+
+    if (threads <= 0)
+    {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cores > 1) ? (int)cores - 1 : 1;
+    }
+    if (threads > ASSET_LOADER_MAX_THREADS)
+    {
+        threads = ASSET_LOADER_MAX_THREADS;
+    }
+
+    g_stopping = 0;
+    for (int i = 0; i < threads; ++i)
+    {
+        if (pthread_create(&g_threads[g_thread_count], NULL, asset_worker_main, NULL) != 0)
+        {
+            break;
+        }
+        g_thread_count++;
+    }
+    // 스레드를 하나도 못 만들어도 asset_loader_wait가 호출 스레드에서 디코딩하므로 동작은 함
+    return (g_thread_count > 0) ? 0 : -1;
+}
+
+void asset_loader_shutdown(void)
+{
+    pthread_mutex_lock(&g_jobs_mutex);
+    g_stopping = 1;
+    pthread_cond_broadcast(&g_job_queued);
+    pthread_mutex_unlock(&g_jobs_mutex);
+
+    for (int i = 0; i < g_thread_count; ++i)
+    {
+        pthread_join(g_threads[i], NULL);
+    }
+    g_thread_count = 0;
+
+    for (int i = 0; i < ASSET_LOADER_MAX_JOBS; ++i)
+    {
+        asset_image_free(&g_jobs[i].image);
+        memset(&g_jobs[i], 0, sizeof(g_jobs[i]));
+    }
+}
+
+int asset_loader_submit(const char *path)
+{
+    if (!path || strlen(path) >= sizeof(g_jobs[0].path))
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&g_jobs_mutex);
+    int index = -1;
+    for (int i = 0; i < ASSET_LOADER_MAX_JOBS; ++i)
+    {
+        if (g_jobs[i].state == ASSET_JOB_FREE)
+        {
+            index = i;
+            break;
+        }
+    }
+    if (index >= 0)
+    {
+        AssetJob *job = &g_jobs[index];
+        strcpy(job->path, path);
+        memset(&job->image, 0, sizeof(job->image));
+        job->seq = g_next_seq++;
+        job->state = ASSET_JOB_QUEUED;
+        pthread_cond_signal(&g_job_queued);
+    }
+    pthread_mutex_unlock(&g_jobs_mutex);
+    return index;
+}
+
+// 결과를 꺼내고 작업 칸 반납 (g_jobs_mutex 잡은 상태)
+static void take_result_locked(int ticket, AssetImage *out)
+{
+    *out = g_jobs[ticket].image;
+    memset(&g_jobs[ticket].image, 0, sizeof(g_jobs[ticket].image));
+    g_jobs[ticket].state = ASSET_JOB_FREE;
+}
+
+int asset_loader_poll(int ticket, AssetImage *out)
+{
+    if (ticket < 0 || ticket >= ASSET_LOADER_MAX_JOBS || !out)
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock(&g_jobs_mutex);
+    int done = (g_jobs[ticket].state == ASSET_JOB_DONE);
+    if (done)
+    {
+        take_result_locked(ticket, out);
+    }
+    pthread_mutex_unlock(&g_jobs_mutex);
+    return done;
+}
+
+void asset_loader_wait(int ticket, AssetImage *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (ticket < 0 || ticket >= ASSET_LOADER_MAX_JOBS)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&g_jobs_mutex);
+    if (g_jobs[ticket].state == ASSET_JOB_QUEUED)
+    {
+        // 워커 대기열 뒤에서 기다리지 않고 직접 처리
+        run_job_locked(ticket);
+    }
+    while (g_jobs[ticket].state == ASSET_JOB_DECODING)
+    {
+        pthread_cond_wait(&g_job_done, &g_jobs_mutex);
+    }
+    if (g_jobs[ticket].state == ASSET_JOB_DONE)
+    {
+        take_result_locked(ticket, out);
+    }
+    pthread_mutex_unlock(&g_jobs_mutex);
+}
@@ -0,0 +1,148 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../include/bench.h"
+#include "../include/game.h"
+#include "../include/job_system.h"
+#include "../include/obstacle.h"
+#include "../include/player.h"
+#include "../include/sound.h"
+#include "../include/stage.h"
+
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 남은 장애물 슬롯을 추격 중인 교수로 채움 (통과 가능 칸에 고르게 배치)
+static void fill_with_professors(Stage *stage)
+{
+    Obstacle professor;
+    int found = 0;
+    for (int i = 0; i < stage->num_obstacles; ++i)
+    {
+        if (stage->obstacles[i].kind == OBSTACLE_KIND_PROFESSOR)
+        {
+            professor = stage->obstacles[i];
+            found = 1;
+            break;
+        }
+    }
+    if (!found)
+    {
+        memset(&professor, 0, sizeof(professor));
+        professor.kind = OBSTACLE_KIND_PROFESSOR;
+        professor.move_speed = SUBPIXELS_PER_TILE / 0.3;
+        professor.sight_range = 10;
+        professor.hp = 999;
+        professor.active = 1;
+        professor.dir = 1;
+    }
+    professor.alert = 1;
+
+    int needed = MAX_OBSTACLES - stage->num_obstacles;
+    if (needed <= 0 || stage->num_passable_tiles <= 0)
+        return;
+
+    for (int k = 0; k < needed; ++k)
+    {
+        const TileCoord *tile = &stage->passable_tiles[(long)k * stage->num_passable_tiles / needed];
+        Obstacle *o = &stage->obstacles[stage->num_obstacles++];
+        *o = professor;
+        o->world_x = tile->x * SUBPIXELS_PER_TILE;
+        o->world_y = tile->y * SUBPIXELS_PER_TILE;
+        o->prev_world_x = o->world_x;
+        o->prev_world_y = o->world_y;
+        o->target_world_x = o->world_x;
+        o->target_world_y = o->world_y;
+        o->move_accumulator = 0.0;
+    }
+}
+
+static unsigned long obstacle_checksum(const Stage *stage)
+{
+    unsigned long hash = 1469598103UL;
+    for (int i = 0; i < stage->num_obstacles; ++i)
+    {
+        const Obstacle *o = &stage->obstacles[i];
+        hash = (hash ^ (unsigned long)(o->world_x * 31 + o->world_y)) * 16777619UL;
+        hash = (hash ^ (unsigned long)o->active) * 16777619UL;
+    }
+    return hash;
+}
+
+int run_obstacle_benchmark(int stage_id, int max_threads, int ticks)
+{
+    static Stage base;
+    static Stage stage;
+
+    if (load_stage(&base, stage_id) != 0)
+    {
+        fprintf(stderr, "벤치마크용 스테이지 %d 로드 실패\n", stage_id);
+        return 1;
+    }
+    fill_with_professors(&base);
+    set_sfx_muted(1); // 교수 패턴이 내는 효과음은 측정 대상이 아님
+
+    if (max_threads <= 0)
+        max_threads = JOB_MAX_WORKERS;
+    if (max_threads > JOB_MAX_WORKERS)
+        max_threads = JOB_MAX_WORKERS;
+    if (ticks <= 0)
+        ticks = 600;
+
+    const double dt = 1.0 / get_obstacle_tick_rate();
+
+    printf("장애물 벤치마크: 스테이지 %d (%s), 장애물 %d개, %d틱, dt %.4fs\n",
+           stage_id, base.name, base.num_obstacles, ticks, dt);
+    printf("%8s %12s %10s %18s\n", "워커", "ms/틱", "속도향상", "체크섬");
+
+    double baseline_ms = 0.0;
+    unsigned long baseline_sum = 0;
+    int deterministic = 1;
+
+    for (int threads = 1; threads <= max_threads; ++threads)
+    {
+        job_system_restart(threads);
+
+        // 매 실행마다 같은 초기 상태/시드에서 시작해야 결과를 비교할 수 있음
+        stage = base;
+        Player player;
+        init_player(&player, &stage);
+        set_obstacle_player_ref(&player);
+        rng_seed(&stage.rng, 12345);
+
+        double start = now_sec();
+        for (int t = 0; t < ticks; ++t)
+        {
+            move_obstacles(&stage, dt);
+        }
+        double ms_per_tick = (now_sec() - start) * 1000.0 / ticks;
+
+        unsigned long sum = obstacle_checksum(&stage);
+        if (threads == 1)
+        {
+            baseline_ms = ms_per_tick;
+            baseline_sum = sum;
+        }
+        else if (sum != baseline_sum)
+        {
+            deterministic = 0;
+        }
+
+        printf("%8d %12.4f %9.2fx %18lx\n", job_system_worker_count(), ms_per_tick,
+               (ms_per_tick > 0.0) ? baseline_ms / ms_per_tick : 0.0, sum);
+    }
+
+    set_obstacle_player_ref(NULL);
+    job_system_shutdown();
+    unload_stage(&base);
+
+    printf("결정성: %s\n", deterministic ? "모든 워커 수에서 결과 동일" : "워커 수에 따라 결과가 다름!");
+    return deterministic ? 0 : 1;
+}
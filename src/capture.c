@@ -0,0 +1,326 @@
+// 플레이 영상 녹화
+// - 링 슬롯 상태는 뮤텍스 하나로 관리하지만, 렌더 스레드는 슬롯 번호를 주고받을 때만 잡음 (변환/쓰기 중에는 안 잡음)
+// - 인코더가 처리 중인 슬롯은 다 쓸 때까지 filled 수에 남아 있으므로 렌더 스레드가 덮어쓰지 않음
+
+#define _POSIX_C_SOURCE 199309L
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../include/capture.h"
+#include "../include/trace.h"
+
+typedef struct
+{
+    unsigned char *pixels;
+    long sequence; // 녹화 시작부터 몇 번째 프레임 자리인지 (시각 / 프레임 간격)
+} CaptureSlot;
+
+static CaptureSlot g_slots[CAPTURE_RING_SLOTS];
+static int g_write_index = 0;  // 렌더 스레드가 다음에 채울 슬롯
+static int g_read_index = 0;   // 인코더가 다음에 쓸 슬롯
+static int g_filled = 0;       // 채웠지만 아직 다 쓰지 않은 슬롯 수
+static int g_producing = 0;    // 렌더 스레드가 읽어 넣는 중
+static int g_stopping = 0;
+static pthread_mutex_t g_ring_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_ring_filled = PTHREAD_COND_INITIALIZER;
+static pthread_t g_encoder_thread;
+
+static int g_active = 0;
+static FILE *g_out = NULL;
+static char g_path[512];
+static int g_width = 0;
+static int g_height = 0;
+static int g_fps = CAPTURE_DEFAULT_FPS;
+static int g_y4m = 0;
+static struct timespec g_start_ts;
+static long g_last_sequence = -1; // 렌더 스레드가 마지막으로 녹화 차례를 본 자리
+
+// 인코더 스레드 전용
+static unsigned char *g_frame_out = NULL; // 변환한 한 프레임 (Y4M이면 Y/U/V 평면, raw면 복사본)
+static size_t g_frame_out_size = 0;
+static long g_written_sequence = -1;
+
+static atomic_ulong g_grabbed = 0;
+static atomic_ulong g_written = 0;
+static atomic_ulong g_repeated = 0;
+static atomic_ulong g_dropped = 0;
+static atomic_ulong g_failed = 0;
+
+// 화면을 그리지 않은 구간(메뉴 입력 대기 등)을 메울 때 최대 반복 수 (1초)
+static long max_repeat_frames(void)
+{
+    return g_fps;
+}
+
+// BT.601 풀 레인지(C420jpeg). 크로마는 2x2 평균
+static void convert_to_yuv420(const unsigned char *argb, unsigned char *out)
+{
+    const int w = g_width;
+    const int h = g_height;
+    unsigned char *plane_y = out;
+    unsigned char *plane_u = out + (size_t)w * h;
+    unsigned char *plane_v = plane_u + (size_t)(w / 2) * (h / 2);
+
+    for (int y = 0; y < h; y += 2)
+    {
+        const uint32_t *row0 = (const uint32_t *)(argb + (size_t)y * w * 4);
+        const uint32_t *row1 = row0 + w;
+        for (int x = 0; x < w; x += 2)
+        {
+            const uint32_t px[4] = {row0[x], row0[x + 1], row1[x], row1[x + 1]};
+            int sum_r = 0, sum_g = 0, sum_b = 0;
+            for (int k = 0; k < 4; ++k)
+            {
+                const int r = (int)((px[k] >> 16) & 0xFF);
+                const int g = (int)((px[k] >> 8) & 0xFF);
+                const int b = (int)(px[k] & 0xFF);
+                plane_y[(size_t)(y + (k >> 1)) * w + x + (k & 1)] = (unsigned char)((77 * r + 150 * g + 29 * b + 128) >> 8);
+                sum_r += r;
+                sum_g += g;
+                sum_b += b;
+            }
+            // 네 픽셀 합이라 4로 나누는 것을 시프트에 합침, 음수가 되지 않도록 128 << 10을 더함
+            const size_t c = (size_t)(y / 2) * (w / 2) + x / 2;
+            plane_u[c] = (unsigned char)((-43 * sum_r - 85 * sum_g + 128 * sum_b + (128 << 10) + 512) >> 10);
+            plane_v[c] = (unsigned char)((128 * sum_r - 107 * sum_g - 21 * sum_b + (128 << 10) + 512) >> 10);
+        }
+    }
+}
+
+static void write_frame_out(void)
+{
+    if (g_y4m)
+        fputs("FRAME\n", g_out);
+    fwrite(g_frame_out, 1, g_frame_out_size, g_out);
+    atomic_fetch_add(&g_written, 1);
+}
+
+static void encode_slot(const CaptureSlot *slot)
+{
+    // 버렸거나 그리지 않은 자리는 직전 프레임으로 메워 재생 시간이 실제와 같게 함
+    if (g_written_sequence >= 0)
+    {
+        long gap = slot->sequence - g_written_sequence - 1;
+        if (gap > max_repeat_frames())
+            gap = max_repeat_frames();
+        for (long i = 0; i < gap; ++i)
+        {
+            write_frame_out();
+            atomic_fetch_add(&g_repeated, 1);
+        }
+    }
+
+    uint64_t trace_encode = trace_begin();
+    if (g_y4m)
+        convert_to_yuv420(slot->pixels, g_frame_out);
+    else
+        memcpy(g_frame_out, slot->pixels, g_frame_out_size);
+    write_frame_out();
+    g_written_sequence = slot->sequence;
+    trace_end("capture encode", "capture", trace_encode);
+}
+
+static void *encoder_thread_func(void *arg)
+{
+    (void)arg;
+    trace_thread_name("capture encoder");
+
+    pthread_mutex_lock(&g_ring_mutex);
+    for (;;)
+    {
+        while (g_filled == 0 && !g_stopping)
+            pthread_cond_wait(&g_ring_filled, &g_ring_mutex);
+        if (g_filled == 0)
+            break;
+
+        CaptureSlot *slot = &g_slots[g_read_index];
+        pthread_mutex_unlock(&g_ring_mutex);
+
+        encode_slot(slot);
+
+        pthread_mutex_lock(&g_ring_mutex);
+        g_read_index = (g_read_index + 1) % CAPTURE_RING_SLOTS;
+        g_filled--;
+    }
+    pthread_mutex_unlock(&g_ring_mutex);
+    return NULL;
+}
+
+static void free_buffers(void)
+{
+    for (int i = 0; i < CAPTURE_RING_SLOTS; ++i)
+    {
+        free(g_slots[i].pixels);
+        g_slots[i].pixels = NULL;
+    }
+    free(g_frame_out);
+    g_frame_out = NULL;
+}
+
+int capture_start(const char *path, int width, int height, int fps)
+{
+    if (g_active || !path || width <= 0 || height <= 0)
+        return -1;
+
+    const size_t len = strlen(path);
+    g_y4m = len >= 4 && strcmp(path + len - 4, ".y4m") == 0;
+    if (g_y4m && ((width & 1) || (height & 1)))
+    {
+        fprintf(stderr, "Y4M 녹화는 짝수 크기만 지원합니다 (%dx%d)\n", width, height);
+        return -1;
+    }
+
+    g_width = width;
+    g_height = height;
+    g_fps = (fps > 0) ? fps : CAPTURE_DEFAULT_FPS;
+    snprintf(g_path, sizeof(g_path), "%s", path);
+
+    // 녹화 중에는 할당하지 않도록 슬롯/변환 버퍼를 미리 잡아 둠
+    const size_t frame_bytes = (size_t)width * height * 4u;
+    g_frame_out_size = g_y4m ? (size_t)width * height * 3u / 2u : frame_bytes;
+    g_frame_out = malloc(g_frame_out_size);
+    int ok = g_frame_out != NULL;
+    for (int i = 0; i < CAPTURE_RING_SLOTS; ++i)
+    {
+        g_slots[i].pixels = malloc(frame_bytes);
+        ok = ok && g_slots[i].pixels != NULL;
+    }
+    if (!ok)
+    {
+        fprintf(stderr, "녹화 버퍼를 할당할 수 없습니다\n");
+        free_buffers();
+        return -1;
+    }
+
+    g_out = fopen(path, "wb");
+    if (!g_out)
+    {
+        fprintf(stderr, "녹화 파일을 열 수 없습니다: %s\n", path);
+        free_buffers();
+        return -1;
+    }
+    setvbuf(g_out, NULL, _IOFBF, 1 << 20);
+    if (g_y4m)
+        fprintf(g_out, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", width, height, g_fps);
+
+    g_write_index = 0;
+    g_read_index = 0;
+    g_filled = 0;
+    g_producing = 0;
+    g_stopping = 0;
+    g_last_sequence = -1;
+    g_written_sequence = -1;
+    atomic_store(&g_grabbed, 0);
+    atomic_store(&g_written, 0);
+    atomic_store(&g_repeated, 0);
+    atomic_store(&g_dropped, 0);
+    atomic_store(&g_failed, 0);
+
+    if (pthread_create(&g_encoder_thread, NULL, encoder_thread_func, NULL) != 0)
+    {
+        fprintf(stderr, "녹화 인코더 스레드를 시작할 수 없습니다\n");
+        fclose(g_out);
+        g_out = NULL;
+        free_buffers();
+        return -1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &g_start_ts);
+    g_active = 1;
+    printf("녹화 시작: %s (%dx%d, %dfps, %s)\n", path, width, height, g_fps, g_y4m ? "Y4M 4:2:0" : "raw ARGB8888");
+    return 0;
+}
+
+void capture_stop(void)
+{
+    if (!g_active)
+        return;
+    g_active = 0;
+
+    pthread_mutex_lock(&g_ring_mutex);
+    g_stopping = 1;
+    pthread_cond_signal(&g_ring_filled);
+    pthread_mutex_unlock(&g_ring_mutex);
+    pthread_join(g_encoder_thread, NULL);
+
+    int write_failed = ferror(g_out) != 0;
+    write_failed = (fclose(g_out) != 0) || write_failed;
+    g_out = NULL;
+    free_buffers();
+
+    CaptureStats stats;
+    capture_get_stats(&stats);
+    printf("녹화 종료: %s, 프레임 %lu (반복 %lu), 인코더 지연으로 버린 프레임 %lu, 읽기 실패 %lu%s\n",
+           g_path, stats.written, stats.repeated, stats.dropped, stats.failed,
+           write_failed ? " (파일 쓰기 오류!)" : "");
+}
+
+int capture_active(void)
+{
+    return g_active;
+}
+
+void *capture_begin_frame(void)
+{
+    if (!g_active)
+        return NULL;
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    const double elapsed = (double)(now.tv_sec - g_start_ts.tv_sec) + (double)(now.tv_nsec - g_start_ts.tv_nsec) / 1e9;
+    const long sequence = (long)(elapsed * g_fps);
+    if (sequence <= g_last_sequence)
+        return NULL; // 아직 다음 녹화 차례가 아님
+    g_last_sequence = sequence;
+
+    pthread_mutex_lock(&g_ring_mutex);
+    CaptureSlot *slot = NULL;
+    if (g_filled < CAPTURE_RING_SLOTS)
+    {
+        slot = &g_slots[g_write_index];
+        slot->sequence = sequence;
+        g_producing = 1;
+    }
+    pthread_mutex_unlock(&g_ring_mutex);
+
+    if (!slot)
+    {
+        atomic_fetch_add(&g_dropped, 1);
+        return NULL;
+    }
+    return slot->pixels;
+}
+
+void capture_end_frame(int ok)
+{
+    if (!g_producing)
+        return;
+
+    pthread_mutex_lock(&g_ring_mutex);
+    g_producing = 0;
+    if (ok)
+    {
+        g_write_index = (g_write_index + 1) % CAPTURE_RING_SLOTS;
+        g_filled++;
+        pthread_cond_signal(&g_ring_filled);
+    }
+    pthread_mutex_unlock(&g_ring_mutex);
+
+    atomic_fetch_add(ok ? &g_grabbed : &g_failed, 1);
+}
+
+void capture_get_stats(CaptureStats *out)
+{
+    if (!out)
+        return;
+    out->grabbed = atomic_load(&g_grabbed);
+    out->written = atomic_load(&g_written);
+    out->repeated = atomic_load(&g_repeated);
+    out->dropped = atomic_load(&g_dropped);
+    out->failed = atomic_load(&g_failed);
+}
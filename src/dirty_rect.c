@@ -0,0 +1,492 @@
+// 더티 사각형 출력 (소프트웨어 렌더러 전용)
+// - 기록: render()가 한 프레임 동안 호출한 그리기 명령을 목록에 저장
+// - 비교: 화면 셀마다 그 셀을 덮는 명령들의 해시를 순서대로 섞어 직전 프레임과 비교
+// - 출력: 달라진 셀을 사각형으로 묶어 클립 사각형마다 목록을 다시 재생한 뒤 그 영역만 창에 올림
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/dirty_rect.h"
+
+typedef enum
+{
+    DRAW_OP_FILL = 0,
+    DRAW_OP_COPY,
+    DRAW_OP_LINE,
+    DRAW_OP_LINES
+} DrawOp;
+
+typedef struct
+{
+    DrawOp op;
+    SDL_Texture *texture;
+    SDL_Rect src;
+    int has_src;
+    SDL_Rect dst;    // FILL/COPY 대상, LINE은 (x, y)-(w, h)를 양 끝점으로 사용
+    int first_point; // LINES: 점 배열 시작 위치
+    int point_count;
+    Uint8 r, g, b, a;    // COPY는 텍스처 색/알파 변조, 그 밖에는 그리기 색
+    SDL_BlendMode blend; // COPY는 텍스처 블렌드 모드, 그 밖에는 그리기 블렌드 모드
+    SDL_Rect bounds; // 화면 안으로 자른 영향 범위 (비었으면 w == 0)
+    uint64_t hash;
+} DrawItem;
+
+struct DirtyRectTracker
+{
+    int width;
+    int height;
+    int cols;
+    int rows;
+    uint64_t *cell_hash;
+    uint64_t *prev_cell_hash;
+    int full_redraw;
+
+    DrawItem *items;
+    int item_count;
+    int item_capacity;
+    SDL_Point *points;
+    int point_count;
+    int point_capacity;
+};
+
+static uint64_t mix64(uint64_t h, uint64_t v)
+{
+    h ^= v + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+    h ^= h >> 31;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    return h ^ (h >> 29);
+}
+
+static uint64_t mix_rect(uint64_t h, const SDL_Rect *rect)
+{
+    h = mix64(h, ((uint64_t)(uint32_t)rect->x << 32) | (uint32_t)rect->y);
+    return mix64(h, ((uint64_t)(uint32_t)rect->w << 32) | (uint32_t)rect->h);
+}
+
+DirtyRectTracker *dirty_rect_create(int width, int height)
+{
+    if (width <= 0 || height <= 0)
+    {
+        return NULL;
+    }
+
+    DirtyRectTracker *tracker = calloc(1, sizeof(*tracker));
+    if (!tracker)
+    {
+        return NULL;
+    }
+
+    tracker->width = width;
+    tracker->height = height;
+    tracker->cols = (width + DIRTY_RECT_CELL_SIZE - 1) / DIRTY_RECT_CELL_SIZE;
+    tracker->rows = (height + DIRTY_RECT_CELL_SIZE - 1) / DIRTY_RECT_CELL_SIZE;
+    tracker->cell_hash = calloc((size_t)tracker->cols * tracker->rows, sizeof(uint64_t));
+    tracker->prev_cell_hash = calloc((size_t)tracker->cols * tracker->rows, sizeof(uint64_t));
+    if (!tracker->cell_hash || !tracker->prev_cell_hash)
+    {
+        dirty_rect_destroy(tracker);
+        return NULL;
+    }
+    tracker->full_redraw = 1;
+    return tracker;
+}
+
+void dirty_rect_destroy(DirtyRectTracker *tracker)
+{
+    if (!tracker)
+    {
+        return;
+    }
+    free(tracker->cell_hash);
+    free(tracker->prev_cell_hash);
+    free(tracker->items);
+    free(tracker->points);
+    free(tracker);
+}
+
+void dirty_rect_invalidate(DirtyRectTracker *tracker)
+{
+    if (tracker)
+    {
+        tracker->full_redraw = 1;
+    }
+}
+
+void dirty_rect_begin_frame(DirtyRectTracker *tracker)
+{
+    if (!tracker)
+    {
+        return;
+    }
+    tracker->item_count = 0;
+    tracker->point_count = 0;
+}
+
+static DrawItem *push_item(DirtyRectTracker *tracker, SDL_Renderer *renderer, DrawOp op)
+{
+    if (tracker->item_count == tracker->item_capacity)
+    {
+        int capacity = tracker->item_capacity ? tracker->item_capacity * 2 : 1024;
+        DrawItem *items = realloc(tracker->items, (size_t)capacity * sizeof(DrawItem));
+        if (!items)
+        {
+            // 기록을 잃으면 비교 결과를 믿을 수 없으므로 다음 출력은 전체를 다시 그림
+            tracker->full_redraw = 1;
+            return NULL;
+        }
+        tracker->items = items;
+        tracker->item_capacity = capacity;
+    }
+
+    DrawItem *item = &tracker->items[tracker->item_count++];
+    memset(item, 0, sizeof(*item));
+    item->op = op;
+    SDL_GetRenderDrawColor(renderer, &item->r, &item->g, &item->b, &item->a);
+    SDL_GetRenderDrawBlendMode(renderer, &item->blend);
+    return item;
+}
+
+// 영향 범위를 화면 안으로 자르고 명령 해시 계산
+static void finish_item(DirtyRectTracker *tracker, DrawItem *item, SDL_Rect bounds)
+{
+    SDL_Rect screen = {0, 0, tracker->width, tracker->height};
+    if (!SDL_IntersectRect(&bounds, &screen, &item->bounds))
+    {
+        item->bounds.w = 0;
+        item->bounds.h = 0;
+    }
+
+    uint64_t h = mix64((uint64_t)item->op, (uint64_t)(uintptr_t)item->texture);
+    h = mix64(h, ((uint64_t)item->r << 24) | ((uint64_t)item->g << 16) | ((uint64_t)item->b << 8) | item->a);
+    h = mix64(h, (uint64_t)item->blend);
+    h = mix_rect(h, &item->dst);
+    if (item->has_src)
+    {
+        h = mix_rect(h, &item->src);
+    }
+    for (int i = 0; i < item->point_count; ++i)
+    {
+        const SDL_Point *p = &tracker->points[item->first_point + i];
+        h = mix64(h, ((uint64_t)(uint32_t)p->x << 32) | (uint32_t)p->y);
+    }
+    item->hash = h;
+}
+
+int dirty_rect_record_clear(DirtyRectTracker *tracker, SDL_Renderer *renderer)
+{
+    DrawItem *item = push_item(tracker, renderer, DRAW_OP_FILL);
+    if (!item)
+        return 0;
+    // SDL_RenderClear는 블렌드 모드를 무시하고 그대로 덮어씀
+    item->blend = SDL_BLENDMODE_NONE;
+    item->dst = (SDL_Rect){0, 0, tracker->width, tracker->height};
+    finish_item(tracker, item, item->dst);
+    return 0;
+}
+
+int dirty_rect_record_copy(DirtyRectTracker *tracker, SDL_Renderer *renderer,
+                           SDL_Texture *texture, const SDL_Rect *src, const SDL_Rect *dst)
+{
+    DrawItem *item = push_item(tracker, renderer, DRAW_OP_COPY);
+    if (!item)
+        return 0;
+    item->texture = texture;
+    // 복사는 그리기 색/블렌드 대신 텍스처 색/알파 변조와 블렌드 모드를 씀 (글리프 아틀라스는 글자마다 다름)
+    SDL_GetTextureColorMod(texture, &item->r, &item->g, &item->b);
+    SDL_GetTextureAlphaMod(texture, &item->a);
+    SDL_GetTextureBlendMode(texture, &item->blend);
+    if (src)
+    {
+        item->src = *src;
+        item->has_src = 1;
+    }
+    item->dst = dst ? *dst : (SDL_Rect){0, 0, tracker->width, tracker->height};
+    finish_item(tracker, item, item->dst);
+    return 0;
+}
+
+int dirty_rect_record_fill(DirtyRectTracker *tracker, SDL_Renderer *renderer, const SDL_Rect *rect)
+{
+    DrawItem *item = push_item(tracker, renderer, DRAW_OP_FILL);
+    if (!item)
+        return 0;
+    item->dst = rect ? *rect : (SDL_Rect){0, 0, tracker->width, tracker->height};
+    finish_item(tracker, item, item->dst);
+    return 0;
+}
+
+int dirty_rect_record_fills(DirtyRectTracker *tracker, SDL_Renderer *renderer, const SDL_Rect *rects, int count)
+{
+    for (int i = 0; rects && i < count; ++i)
+    {
+        dirty_rect_record_fill(tracker, renderer, &rects[i]);
+    }
+    return 0;
+}
+
+int dirty_rect_record_outline(DirtyRectTracker *tracker, SDL_Renderer *renderer, const SDL_Rect *rect)
+{
+    if (!rect || rect->w <= 0 || rect->h <= 0)
+    {
+        return 0;
+    }
+    // SDL_RenderDrawRect와 같은 1px 테두리를 네 변의 채우기로 기록
+    SDL_Rect edges[4] = {
+        {rect->x, rect->y, rect->w, 1},
+        {rect->x, rect->y + rect->h - 1, rect->w, 1},
+        {rect->x, rect->y, 1, rect->h},
+        {rect->x + rect->w - 1, rect->y, 1, rect->h},
+    };
+    return dirty_rect_record_fills(tracker, renderer, edges, 4);
+}
+
+static SDL_Rect line_bounds(int x1, int y1, int x2, int y2)
+{
+    int min_x = x1 < x2 ? x1 : x2;
+    int min_y = y1 < y2 ? y1 : y2;
+    int max_x = x1 > x2 ? x1 : x2;
+    int max_y = y1 > y2 ? y1 : y2;
+    return (SDL_Rect){min_x, min_y, max_x - min_x + 1, max_y - min_y + 1};
+}
+
+int dirty_rect_record_line(DirtyRectTracker *tracker, SDL_Renderer *renderer, int x1, int y1, int x2, int y2)
+{
+    DrawItem *item = push_item(tracker, renderer, DRAW_OP_LINE);
+    if (!item)
+        return 0;
+    item->dst = (SDL_Rect){x1, y1, x2, y2};
+    finish_item(tracker, item, line_bounds(x1, y1, x2, y2));
+    return 0;
+}
+
+int dirty_rect_record_lines(DirtyRectTracker *tracker, SDL_Renderer *renderer, const SDL_Point *points, int count)
+{
+    if (!points || count <= 0)
+    {
+        return 0;
+    }
+
+    if (tracker->point_count + count > tracker->point_capacity)
+    {
+        int capacity = tracker->point_capacity ? tracker->point_capacity : 256;
+        while (capacity < tracker->point_count + count)
+            capacity *= 2;
+        SDL_Point *grown = realloc(tracker->points, (size_t)capacity * sizeof(SDL_Point));
+        if (!grown)
+        {
+            tracker->full_redraw = 1;
+            return 0;
+        }
+        tracker->points = grown;
+        tracker->point_capacity = capacity;
+    }
+
+    DrawItem *item = push_item(tracker, renderer, DRAW_OP_LINES);
+    if (!item)
+        return 0;
+    item->first_point = tracker->point_count;
+    item->point_count = count;
+    memcpy(&tracker->points[tracker->point_count], points, (size_t)count * sizeof(SDL_Point));
+    tracker->point_count += count;
+
+    SDL_Rect bounds = line_bounds(points[0].x, points[0].y, points[0].x, points[0].y);
+    for (int i = 1; i < count; ++i)
+    {
+        SDL_Rect seg = line_bounds(points[i].x, points[i].y, points[i].x, points[i].y);
+        SDL_UnionRect(&bounds, &seg, &bounds);
+    }
+    finish_item(tracker, item, bounds);
+    return 0;
+}
+
+static void hash_cells(DirtyRectTracker *tracker)
+{
+    const int cell_count = tracker->cols * tracker->rows;
+    for (int i = 0; i < cell_count; ++i)
+    {
+        tracker->cell_hash[i] = 0x84222325CBF29CE4ULL;
+    }
+
+    for (int i = 0; i < tracker->item_count; ++i)
+    {
+        const DrawItem *item = &tracker->items[i];
+        if (item->bounds.w <= 0 || item->bounds.h <= 0)
+        {
+            continue;
+        }
+        int cx0 = item->bounds.x / DIRTY_RECT_CELL_SIZE;
+        int cy0 = item->bounds.y / DIRTY_RECT_CELL_SIZE;
+        int cx1 = (item->bounds.x + item->bounds.w - 1) / DIRTY_RECT_CELL_SIZE;
+        int cy1 = (item->bounds.y + item->bounds.h - 1) / DIRTY_RECT_CELL_SIZE;
+        for (int cy = cy0; cy <= cy1; ++cy)
+        {
+            uint64_t *row = &tracker->cell_hash[cy * tracker->cols];
+            for (int cx = cx0; cx <= cx1; ++cx)
+            {
+                row[cx] = mix64(row[cx], item->hash);
+            }
+        }
+    }
+}
+
+// 달라진 셀을 가로로 이어 붙이고, 바로 윗줄에 폭이 같은 사각형이 있으면 세로로 늘림
+static int collect_dirty_rects(const DirtyRectTracker *tracker, SDL_Rect *rects, int max_rects)
+{
+    int count = 0;
+    for (int cy = 0; cy < tracker->rows; ++cy)
+    {
+        const uint64_t *cur = &tracker->cell_hash[cy * tracker->cols];
+        const uint64_t *prev = &tracker->prev_cell_hash[cy * tracker->cols];
+        int cx = 0;
+        while (cx < tracker->cols)
+        {
+            if (!tracker->full_redraw && cur[cx] == prev[cx])
+            {
+                cx++;
+                continue;
+            }
+            int start = cx;
+            while (cx < tracker->cols && (tracker->full_redraw || cur[cx] != prev[cx]))
+            {
+                cx++;
+            }
+
+            SDL_Rect run = {start * DIRTY_RECT_CELL_SIZE,
+                            cy * DIRTY_RECT_CELL_SIZE,
+                            (cx - start) * DIRTY_RECT_CELL_SIZE,
+                            DIRTY_RECT_CELL_SIZE};
+            if (run.x + run.w > tracker->width)
+                run.w = tracker->width - run.x;
+            if (run.y + run.h > tracker->height)
+                run.h = tracker->height - run.y;
+
+            int merged = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                if (rects[i].x == run.x && rects[i].w == run.w && rects[i].y + rects[i].h == run.y)
+                {
+                    rects[i].h += run.h;
+                    merged = 1;
+                    break;
+                }
+            }
+            if (merged)
+                continue;
+            if (count == max_rects)
+                return -1;
+            rects[count++] = run;
+        }
+    }
+    return count;
+}
+
+static void replay_item(SDL_Renderer *renderer, const DirtyRectTracker *tracker, const DrawItem *item)
+{
+    switch (item->op)
+    {
+    case DRAW_OP_COPY:
+    {
+        // 기록 당시 변조/블렌드로 그린 뒤 지금 값을 되돌림 (안 그러면 탄약 없음 아이콘의 빨간색이 투사체 텍스처에 남음)
+        Uint8 r, g, b, a;
+        SDL_BlendMode blend;
+        SDL_GetTextureColorMod(item->texture, &r, &g, &b);
+        SDL_GetTextureAlphaMod(item->texture, &a);
+        SDL_GetTextureBlendMode(item->texture, &blend);
+        SDL_SetTextureColorMod(item->texture, item->r, item->g, item->b);
+        SDL_SetTextureAlphaMod(item->texture, item->a);
+        SDL_SetTextureBlendMode(item->texture, item->blend);
+        SDL_RenderCopy(renderer, item->texture, item->has_src ? &item->src : NULL, &item->dst);
+        SDL_SetTextureColorMod(item->texture, r, g, b);
+        SDL_SetTextureAlphaMod(item->texture, a);
+        SDL_SetTextureBlendMode(item->texture, blend);
+        break;
+    }
+    case DRAW_OP_FILL:
+        SDL_SetRenderDrawBlendMode(renderer, item->blend);
+        SDL_SetRenderDrawColor(renderer, item->r, item->g, item->b, item->a);
+        SDL_RenderFillRect(renderer, &item->dst);
+        break;
+    case DRAW_OP_LINE:
+        SDL_SetRenderDrawBlendMode(renderer, item->blend);
+        SDL_SetRenderDrawColor(renderer, item->r, item->g, item->b, item->a);
+        SDL_RenderDrawLine(renderer, item->dst.x, item->dst.y, item->dst.w, item->dst.h);
+        break;
+    case DRAW_OP_LINES:
+        SDL_SetRenderDrawBlendMode(renderer, item->blend);
+        SDL_SetRenderDrawColor(renderer, item->r, item->g, item->b, item->a);
+        SDL_RenderDrawLines(renderer, &tracker->points[item->first_point], item->point_count);
+        break;
+    }
+}
+
+int dirty_rect_present(DirtyRectTracker *tracker, SDL_Renderer *renderer, SDL_Window *window, long *out_pixels)
+{
+    if (out_pixels)
+        *out_pixels = 0;
+    if (!tracker || !renderer || !window)
+    {
+        return -1;
+    }
+
+    // 창 표면 크기가 논리 크기와 다르면(HiDPI 등) 셀 좌표를 창 좌표로 쓸 수 없으므로 매번 전체 갱신
+    SDL_Surface *surface = SDL_GetWindowSurface(window);
+    int exact_surface = surface && surface->w == tracker->width && surface->h == tracker->height;
+    if (!exact_surface)
+    {
+        tracker->full_redraw = 1;
+    }
+
+    hash_cells(tracker);
+
+    SDL_Rect rects[DIRTY_RECT_MAX_RECTS];
+    int rect_count = collect_dirty_rects(tracker, rects, DIRTY_RECT_MAX_RECTS);
+    long pixels = 0;
+    for (int i = 0; i < rect_count; ++i)
+    {
+        pixels += (long)rects[i].w * rects[i].h;
+    }
+    // 사각형이 너무 많거나 화면 대부분이 바뀌었으면 한 번에 전체를 그리는 편이 쌈
+    if (rect_count < 0 || pixels * 4 > (long)tracker->width * tracker->height * 3)
+    {
+        rects[0] = (SDL_Rect){0, 0, tracker->width, tracker->height};
+        rect_count = 1;
+        pixels = (long)tracker->width * tracker->height;
+    }
+
+    for (int r = 0; r < rect_count; ++r)
+    {
+        SDL_RenderSetClipRect(renderer, &rects[r]);
+        for (int i = 0; i < tracker->item_count; ++i)
+        {
+            const DrawItem *item = &tracker->items[i];
+            if (item->bounds.w > 0 && SDL_HasIntersection(&item->bounds, &rects[r]))
+            {
+                replay_item(renderer, tracker, item);
+            }
+        }
+    }
+    SDL_RenderSetClipRect(renderer, NULL);
+
+    int result = rect_count;
+    if (rect_count > 0)
+    {
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+        SDL_RenderFlush(renderer);
+#endif
+        int update_failed = exact_surface ? SDL_UpdateWindowSurfaceRects(window, rects, rect_count)
+                                          : SDL_UpdateWindowSurface(window);
+        if (update_failed != 0)
+        {
+            result = -1;
+        }
+    }
+
+    uint64_t *swap = tracker->prev_cell_hash;
+    tracker->prev_cell_hash = tracker->cell_hash;
+    tracker->cell_hash = swap;
+    tracker->full_redraw = (result < 0);
+    if (out_pixels)
+        *out_pixels = pixels;
+    return result;
+}
@@ -0,0 +1,180 @@
+#define _POSIX_C_SOURCE 200112L
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../include/frame_pacer.h"
+
+#define FRAME_PACER_DEFAULT_REFRESH_HZ 60.0
+#define FRAME_PACER_CALIBRATION_SKIP 5      // 창 생성 직후 프레임은 들쭉날쭉하므로 버림
+#define FRAME_PACER_VSYNC_MIN_RATIO 0.85    // 중앙값이 주사율 주기의 85% 이상이면 vsync 동작
+#define FRAME_PACER_EMA_WEIGHT 0.05
+
+static long long monotonic_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void sleep_until_ns(long long deadline_ns)
+{
+    struct timespec deadline = {
+        .tv_sec = (time_t)(deadline_ns / 1000000000LL),
+        .tv_nsec = (long)(deadline_ns % 1000000000LL)};
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+    {
+    }
+}
+
+static void set_target(FramePacer *pacer, FramePacerMode mode, double target_hz)
+{
+    pacer->stats.mode = mode;
+    pacer->stats.target_hz = target_hz;
+    pacer->period_ns = (target_hz > 0.0) ? (long long)llround(1e9 / target_hz) : 0;
+    pacer->next_deadline_ns = 0;
+}
+
+void frame_pacer_init(FramePacer *pacer, const FramePacerConfig *config, double refresh_hz, int vsync_on)
+{
+    if (!pacer)
+        return;
+
+    memset(pacer, 0, sizeof(*pacer));
+    if (refresh_hz <= 0.0)
+        refresh_hz = FRAME_PACER_DEFAULT_REFRESH_HZ;
+    pacer->stats.refresh_hz = refresh_hz;
+    pacer->vsync_on = vsync_on;
+    pacer->uncapped = config && config->uncapped;
+
+    double cap = (config && config->fps_cap > 0.0) ? config->fps_cap : 0.0;
+    if (pacer->uncapped)
+    {
+        // vsync를 끄지 못했으면 화면 표시가 어차피 주사율에 묶임
+        if (vsync_on)
+            set_target(pacer, FRAME_PACER_CALIBRATING, refresh_hz);
+        else
+            set_target(pacer, FRAME_PACER_UNCAPPED, 0.0);
+        return;
+    }
+
+    if (cap > 0.0 && (cap < refresh_hz * 0.95 || !vsync_on))
+    {
+        set_target(pacer, FRAME_PACER_SLEEP, cap);
+        return;
+    }
+
+    if (vsync_on)
+        set_target(pacer, FRAME_PACER_CALIBRATING, refresh_hz);
+    else
+        set_target(pacer, FRAME_PACER_SLEEP, refresh_hz);
+}
+
+void frame_pacer_restart(FramePacer *pacer)
+{
+    if (!pacer)
+        return;
+    pacer->last_frame_ns = 0;
+    pacer->next_deadline_ns = 0;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+// 측정한 간격의 중앙값이 주사율 주기에 가까우면 vsync가 실제로 기다려 주는 것
+static void finish_calibration(FramePacer *pacer)
+{
+    double sorted[32];
+    int n = pacer->calibration_count;
+    memcpy(sorted, pacer->calibration_ms, (size_t)n * sizeof(double));
+    qsort(sorted, (size_t)n, sizeof(double), compare_double);
+    double median_ms = sorted[n / 2];
+    double refresh_period_ms = 1000.0 / pacer->stats.refresh_hz;
+
+    if (median_ms >= refresh_period_ms * FRAME_PACER_VSYNC_MIN_RATIO)
+        set_target(pacer, FRAME_PACER_VSYNC, pacer->stats.refresh_hz);
+    else if (pacer->uncapped)
+        set_target(pacer, FRAME_PACER_UNCAPPED, 0.0);
+    else
+        set_target(pacer, FRAME_PACER_SLEEP, pacer->stats.refresh_hz);
+}
+
+static void record_interval(FramePacer *pacer, double interval_ms)
+{
+    FramePacerStats *stats = &pacer->stats;
+    stats->frames++;
+    stats->interval_avg_ms = (stats->frames == 1)
+                                 ? interval_ms
+                                 : stats->interval_avg_ms + (interval_ms - stats->interval_avg_ms) * FRAME_PACER_EMA_WEIGHT;
+
+    if (pacer->period_ns <= 0 || stats->mode == FRAME_PACER_CALIBRATING)
+        return;
+
+    double target_ms = (double)pacer->period_ns / 1e6;
+    double error_ms = fabs(interval_ms - target_ms);
+    stats->error_avg_ms += (error_ms - stats->error_avg_ms) * FRAME_PACER_EMA_WEIGHT;
+    if (error_ms > stats->error_max_ms)
+        stats->error_max_ms = error_ms;
+    if (interval_ms > target_ms * 1.5)
+        stats->long_frames++;
+}
+
+void frame_pacer_end_frame(FramePacer *pacer)
+{
+    if (!pacer)
+        return;
+
+    if (pacer->stats.mode == FRAME_PACER_SLEEP && pacer->period_ns > 0)
+    {
+        long long now = monotonic_now_ns();
+        if (pacer->next_deadline_ns == 0)
+        {
+            pacer->next_deadline_ns = now + pacer->period_ns;
+        }
+        else
+        {
+            pacer->next_deadline_ns += pacer->period_ns;
+            // 한 주기 이상 밀렸으면 따라잡으려 몰아서 그리지 않고 지금부터 다시 셈
+            if (pacer->next_deadline_ns < now)
+                pacer->next_deadline_ns = now + pacer->period_ns;
+        }
+        sleep_until_ns(pacer->next_deadline_ns);
+    }
+
+    long long now = monotonic_now_ns();
+    if (pacer->last_frame_ns != 0)
+    {
+        double interval_ms = (double)(now - pacer->last_frame_ns) / 1e6;
+        record_interval(pacer, interval_ms);
+
+        if (pacer->stats.mode == FRAME_PACER_CALIBRATING && pacer->stats.frames > FRAME_PACER_CALIBRATION_SKIP)
+        {
+            pacer->calibration_ms[pacer->calibration_count++] = interval_ms;
+            if (pacer->calibration_count == (int)(sizeof(pacer->calibration_ms) / sizeof(pacer->calibration_ms[0])))
+                finish_calibration(pacer);
+        }
+    }
+    pacer->last_frame_ns = now;
+}
+
+const char *frame_pacer_mode_name(FramePacerMode mode)
+{
+    switch (mode)
+    {
+    case FRAME_PACER_CALIBRATING:
+        return "calibrating";
+    case FRAME_PACER_VSYNC:
+        return "vsync";
+    case FRAME_PACER_SLEEP:
+        return "sleep";
+    case FRAME_PACER_UNCAPPED:
+        return "uncapped";
+    }
+    return "?";
+}
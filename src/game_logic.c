@@ -1,6 +1,8 @@
 #include <stdio.h>
+#include <stdint.h>
 #include "../include/game.h"
 #include "../include/player.h"
+#include "../include/hazard.h"
 
 
 int is_goal_reached(const Stage *stage, const Player *player) {
@@ -23,62 +25,33 @@ int is_goal_reached(const Stage *stage, const Player *player) {
 }
 
 
-int check_collision(Stage *stage, Player *player) // 장애물 충돌 조건  return 1이면 사망 return 0이면 생존
+// 장애물 충돌 조건  return 1이면 충돌 return 0이면 충돌 없음
+// - 읽기 전용. 쉴드로 막을 수 있는 일반 장애물이면 *shieldable_index에 인덱스, 아니면 -1
+// - 쉴드 소모와 장애물 제거는 호출자(시뮬레이션 스텝)가 반영
+int check_collision(const Stage *stage, const Player *player, int *shieldable_index)
 {
-    for (int i = 0; i < stage->num_obstacles; i++)
-    {
-        Obstacle *o = &stage->obstacles[i]; // 장애물 구조체 내부 배열에서 정보 초기화
-
-        if (!o->active)
-            continue;
-
-        if (o->kind == OBSTACLE_KIND_BREAKABLE_WALL) // 꺠지는 벽은 충돌 제외
-            continue;
-
-        int cx = o->world_x + SUBPIXELS_PER_TILE / 2; // 장애물 좌표 초기화
-        int cy = o->world_y + SUBPIXELS_PER_TILE / 2;
+    if (shieldable_index)
+        *shieldable_index = -1;
 
-        if (!is_world_point_inside_player(player, cx, cy)) 
-            continue;
+    // 중심점이 플레이어 상자 안인 장애물 비트마스크 (SoA 일괄 판정, 깨지는 벽/비활성은 제외됨)
+    uint64_t obstacle_hits = hazard_obstacle_hits(stage, player);
+    if (obstacle_hits)
+    {
+        int i = __builtin_ctzll(obstacle_hits); // 가장 앞 인덱스부터 처리 (기존 순회 순서와 동일)
 
         // 교수 충돌 (Stage 6 보스전 포함)
-
-        if (o->kind == OBSTACLE_KIND_PROFESSOR)
-        {
+        if (stage->hazards.obstacle_fatal[i])
             return 1;
-        }
 
-        //   일반 장애물 충돌
+        //   일반 장애물 충돌 (쉴드가 있으면 호출자가 막음)
+        if (shieldable_index && player->shield_count > 0)
+            *shieldable_index = i;
 
-        if (player->shield_count > 0)
-        {
-            player->shield_count--;
-            o->active = 0; // 일반 장애물 제거
-            return 0;
-        }
-
-        return 1; 
+        return 1;
     }
 
-    if (stage->num_professor_clones > 0)
-    {
-        const int tile_size = SUBPIXELS_PER_TILE;
-        for (int i = 0; i < MAX_PROFESSOR_CLONES; ++i)
-        {
-            const ProfessorClone *clone = &stage->professor_clones[i];
-            if (!clone->active)
-            {
-                continue;
-            }
-
-            int center_x = clone->tile_x * tile_size + tile_size / 2;
-            int center_y = clone->tile_y * tile_size + tile_size / 2;
-            if (is_world_point_inside_player(player, center_x, center_y))
-            {
-                return 1; // 분신 접촉: 즉시 게임오버 (쉴드 무시)
-            }
-        }
-    }
+    if (stage->num_professor_clones > 0 && hazard_clone_hits(stage, player))
+        return 1; // 분신 접촉: 즉시 게임오버 (쉴드 무시)
 
     return 0;
 }
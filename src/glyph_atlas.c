@@ -0,0 +1,359 @@
+// 글리프 아틀라스
+// - 페이지는 ARGB8888 정적 텍스처, 한 줄 높이가 모두 폰트 높이라 줄 단위로 왼쪽부터 채움
+// - 글자 조회는 코드 포인트 기준 열린 주소 해시 (선형 탐사)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/glyph_atlas.h"
+
+#define GLYPH_ATLAS_PADDING 1 // 확대해서 그릴 때 옆 글자가 번지지 않도록 띄움
+
+typedef struct
+{
+    Uint32 codepoint; // 0이면 빈 칸
+    int page;         // -1이면 그릴 것 없음 (공백, 없는 글자)
+    SDL_Rect src;
+    int advance;
+} GlyphEntry;
+
+struct GlyphAtlas
+{
+    SDL_Renderer *renderer;
+    TTF_Font *font;
+    int line_height;
+    SDL_Texture *pages[GLYPH_ATLAS_MAX_PAGES];
+    int page_count;
+    int pen_x; // 마지막 페이지의 다음 빈 자리
+    int pen_y;
+    int full;  // 페이지를 더 만들 수 없음
+    GlyphEntry glyphs[GLYPH_ATLAS_MAX_GLYPHS];
+    GlyphAtlasStats stats;
+};
+
+// UTF-8 한 글자 해독 (잘못된 바이트는 '?'로 보고 한 바이트 넘김)
+static Uint32 next_codepoint(const unsigned char **cursor)
+{
+    const unsigned char *s = *cursor;
+    Uint32 cp = s[0];
+    int extra = 0;
+    if (cp >= 0xF0 && cp <= 0xF4)
+    {
+        cp &= 0x07;
+        extra = 3;
+    }
+    else if (cp >= 0xE0)
+    {
+        cp &= 0x0F;
+        extra = 2;
+    }
+    else if (cp >= 0xC2 && cp < 0xE0)
+    {
+        cp &= 0x1F;
+        extra = 1;
+    }
+    else if (cp >= 0x80)
+    {
+        *cursor = s + 1;
+        return '?';
+    }
+
+    for (int i = 1; i <= extra; ++i)
+    {
+        if ((s[i] & 0xC0) != 0x80)
+        {
+            *cursor = s + 1;
+            return '?';
+        }
+        cp = (cp << 6) | (s[i] & 0x3F);
+    }
+    *cursor = s + 1 + extra;
+    return cp ? cp : '?'; // 0은 해시 표의 빈 칸 표시
+}
+
+static int encode_utf8(Uint32 cp, char out[5])
+{
+    int n;
+    if (cp < 0x80)
+    {
+        out[0] = (char)cp;
+        n = 1;
+    }
+    else if (cp < 0x800)
+    {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        n = 2;
+    }
+    else if (cp < 0x10000)
+    {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        n = 3;
+    }
+    else
+    {
+        out[0] = (char)(0xF0 | (cp >> 18));
+        out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = (char)(0x80 | (cp & 0x3F));
+        n = 4;
+    }
+    out[n] = '\0';
+    return n;
+}
+
+GlyphAtlas *glyph_atlas_create(SDL_Renderer *renderer, TTF_Font *font)
+{
+    if (!renderer || !font)
+    {
+        return NULL;
+    }
+
+    GlyphAtlas *atlas = calloc(1, sizeof(*atlas));
+    if (!atlas)
+    {
+        return NULL;
+    }
+    atlas->renderer = renderer;
+    atlas->font = font;
+    atlas->line_height = TTF_FontHeight(font);
+    if (atlas->line_height <= 0 || atlas->line_height + GLYPH_ATLAS_PADDING > GLYPH_ATLAS_PAGE_SIZE)
+    {
+        free(atlas);
+        return NULL;
+    }
+    return atlas;
+}
+
+void glyph_atlas_destroy(GlyphAtlas *atlas)
+{
+    if (!atlas)
+    {
+        return;
+    }
+    for (int i = 0; i < atlas->page_count; ++i)
+    {
+        SDL_DestroyTexture(atlas->pages[i]);
+    }
+    free(atlas);
+}
+
+static int add_page(GlyphAtlas *atlas)
+{
+    if (atlas->page_count == GLYPH_ATLAS_MAX_PAGES)
+    {
+        return -1;
+    }
+
+    SDL_Texture *page = SDL_CreateTexture(atlas->renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC,
+                                          GLYPH_ATLAS_PAGE_SIZE, GLYPH_ATLAS_PAGE_SIZE);
+    if (!page)
+    {
+        fprintf(stderr, "Glyph atlas page creation failed: %s\n", SDL_GetError());
+        return -1;
+    }
+
+    // 정적 텍스처 초기 내용은 정해져 있지 않으므로 투명으로 채움
+    Uint32 *clear = calloc((size_t)GLYPH_ATLAS_PAGE_SIZE * GLYPH_ATLAS_PAGE_SIZE, sizeof(Uint32));
+    if (!clear)
+    {
+        SDL_DestroyTexture(page);
+        return -1;
+    }
+    SDL_UpdateTexture(page, NULL, clear, GLYPH_ATLAS_PAGE_SIZE * (int)sizeof(Uint32));
+    free(clear);
+    SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND);
+
+    atlas->pages[atlas->page_count++] = page;
+    atlas->pen_x = 0;
+    atlas->pen_y = 0;
+    atlas->stats.pages = atlas->page_count;
+    return 0;
+}
+
+// w×(줄 높이) 자리 확보. 실패 시 -1
+static int reserve_cell(GlyphAtlas *atlas, int w, SDL_Rect *out)
+{
+    if (w + GLYPH_ATLAS_PADDING > GLYPH_ATLAS_PAGE_SIZE || atlas->full)
+    {
+        return -1;
+    }
+
+    const int row_h = atlas->line_height + GLYPH_ATLAS_PADDING;
+    if (atlas->page_count > 0 && atlas->pen_x + w + GLYPH_ATLAS_PADDING > GLYPH_ATLAS_PAGE_SIZE)
+    {
+        atlas->pen_x = 0;
+        atlas->pen_y += row_h;
+    }
+    if (atlas->page_count == 0 || atlas->pen_y + row_h > GLYPH_ATLAS_PAGE_SIZE)
+    {
+        if (add_page(atlas) != 0)
+        {
+            atlas->full = 1;
+            return -1;
+        }
+    }
+
+    *out = (SDL_Rect){atlas->pen_x, atlas->pen_y, w, atlas->line_height};
+    atlas->pen_x += w + GLYPH_ATLAS_PADDING;
+    return atlas->page_count - 1;
+}
+
+// 글자를 흰색으로 래스터화해 아틀라스에 붙임
+static void rasterize_glyph(GlyphAtlas *atlas, GlyphEntry *entry)
+{
+    entry->page = -1;
+    entry->advance = 0;
+
+    int minx, maxx, miny, maxy, advance;
+    int have_metrics = entry->codepoint <= 0xFFFF &&
+                       TTF_GlyphMetrics(atlas->font, (Uint16)entry->codepoint, &minx, &maxx, &miny, &maxy, &advance) == 0;
+
+    if (entry->codepoint == ' ' || entry->codepoint == '\t')
+    {
+        // 공백은 그릴 것 없이 간격만
+        int space_w = 0;
+        TTF_SizeUTF8(atlas->font, " ", &space_w, NULL);
+        entry->advance = have_metrics ? advance : space_w;
+        return;
+    }
+
+    char utf8[5];
+    encode_utf8(entry->codepoint, utf8);
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface *surface = TTF_RenderUTF8_Blended(atlas->font, utf8, white);
+    atlas->stats.rasterized++;
+    if (!surface)
+    {
+        atlas->stats.missing++;
+        return;
+    }
+    if (surface->format->format != SDL_PIXELFORMAT_ARGB8888)
+    {
+        SDL_Surface *converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+        SDL_FreeSurface(surface);
+        surface = converted;
+        if (!surface)
+        {
+            atlas->stats.missing++;
+            return;
+        }
+    }
+
+    entry->advance = have_metrics ? advance : surface->w;
+    SDL_Rect cell;
+    int page = reserve_cell(atlas, surface->w, &cell);
+    if (page < 0)
+    {
+        atlas->stats.missing++;
+        SDL_FreeSurface(surface);
+        return;
+    }
+
+    // 한 글자 렌더링 결과는 폰트 높이와 같아야 하지만 넘치면 잘라서 붙임
+    SDL_Rect upload = cell;
+    if (surface->h < upload.h)
+    {
+        upload.h = surface->h;
+    }
+    SDL_UpdateTexture(atlas->pages[page], &upload, surface->pixels, surface->pitch);
+    SDL_FreeSurface(surface);
+
+    entry->page = page;
+    entry->src = cell;
+}
+
+static GlyphEntry *find_glyph(GlyphAtlas *atlas, Uint32 codepoint)
+{
+    const Uint32 mask = GLYPH_ATLAS_MAX_GLYPHS - 1;
+    Uint32 slot = (codepoint * 2654435761u) & mask;
+    for (int probe = 0; probe < GLYPH_ATLAS_MAX_GLYPHS; ++probe, slot = (slot + 1) & mask)
+    {
+        GlyphEntry *entry = &atlas->glyphs[slot];
+        if (entry->codepoint == codepoint)
+        {
+            return entry;
+        }
+        if (entry->codepoint == 0)
+        {
+            // 표를 끝까지 채우면 없는 글자 조회가 끝나지 않으므로 한 칸은 비워 둠
+            if (atlas->stats.glyphs >= GLYPH_ATLAS_MAX_GLYPHS - 1)
+            {
+                return NULL;
+            }
+            entry->codepoint = codepoint;
+            atlas->stats.glyphs++;
+            rasterize_glyph(atlas, entry);
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+int glyph_atlas_layout(GlyphAtlas *atlas, const char *utf8, int x, int y, GlyphQuad *quads, int max_quads, int *out_w)
+{
+    int count = 0;
+    int pen_x = x;
+    if (atlas && utf8)
+    {
+        const unsigned char *cursor = (const unsigned char *)utf8;
+        while (*cursor)
+        {
+            Uint32 cp = next_codepoint(&cursor);
+            GlyphEntry *glyph = find_glyph(atlas, cp);
+            if (!glyph)
+            {
+                continue;
+            }
+            if (glyph->page >= 0 && quads && count < max_quads)
+            {
+                quads[count].texture = atlas->pages[glyph->page];
+                quads[count].src = glyph->src;
+                quads[count].dst = (SDL_Rect){pen_x, y, glyph->src.w, glyph->src.h};
+                count++;
+            }
+            pen_x += glyph->advance;
+        }
+    }
+    if (out_w)
+    {
+        *out_w = pen_x - x;
+    }
+    return count;
+}
+
+void glyph_atlas_measure(GlyphAtlas *atlas, const char *utf8, int *out_w, int *out_h)
+{
+    glyph_atlas_layout(atlas, utf8, 0, 0, NULL, 0, out_w);
+    if (out_h)
+    {
+        *out_h = atlas ? atlas->line_height : 0;
+    }
+}
+
+void glyph_atlas_warm(GlyphAtlas *atlas, const char *utf8)
+{
+    glyph_atlas_layout(atlas, utf8, 0, 0, NULL, 0, NULL);
+}
+
+int glyph_atlas_line_height(const GlyphAtlas *atlas)
+{
+    return atlas ? atlas->line_height : 0;
+}
+
+void glyph_atlas_get_stats(const GlyphAtlas *atlas, GlyphAtlasStats *out)
+{
+    if (!out)
+    {
+        return;
+    }
+    if (!atlas)
+    {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    *out = atlas->stats;
+}
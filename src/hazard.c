@@ -0,0 +1,140 @@
+#include <math.h>
+
+#include "../include/hazard.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+void hazard_sync_obstacle(Stage *stage, int index)
+{
+    HazardSoA *h = &stage->hazards;
+    const Obstacle *o = &stage->obstacles[index];
+
+    // 깨지는 벽은 충돌 제외
+    if (index >= stage->num_obstacles || !o->active || o->kind == OBSTACLE_KIND_BREAKABLE_WALL)
+    {
+        h->obstacle_cx[index] = HAZARD_INACTIVE_COORD;
+        h->obstacle_cy[index] = HAZARD_INACTIVE_COORD;
+        h->obstacle_fatal[index] = 0;
+        return;
+    }
+
+    h->obstacle_cx[index] = o->world_x + SUBPIXELS_PER_TILE / 2;
+    h->obstacle_cy[index] = o->world_y + SUBPIXELS_PER_TILE / 2;
+    h->obstacle_fatal[index] = (o->kind == OBSTACLE_KIND_PROFESSOR);
+}
+
+void hazard_sync_clone(Stage *stage, int index)
+{
+    HazardSoA *h = &stage->hazards;
+    const ProfessorClone *clone = &stage->professor_clones[index];
+
+    if (!clone->active)
+    {
+        h->clone_cx[index] = HAZARD_INACTIVE_COORD;
+        h->clone_cy[index] = HAZARD_INACTIVE_COORD;
+        return;
+    }
+
+    h->clone_cx[index] = clone->tile_x * SUBPIXELS_PER_TILE + SUBPIXELS_PER_TILE / 2;
+    h->clone_cy[index] = clone->tile_y * SUBPIXELS_PER_TILE + SUBPIXELS_PER_TILE / 2;
+}
+
+void hazard_sync_bullet(Stage *stage, int index)
+{
+    HazardSoA *h = &stage->hazards;
+    const ProfessorBullet *bullet = &stage->professor_bullets[index];
+
+    if (!bullet->active)
+    {
+        h->bullet_cx[index] = HAZARD_INACTIVE_COORD;
+        h->bullet_cy[index] = HAZARD_INACTIVE_COORD;
+        return;
+    }
+
+    h->bullet_cx[index] = (int)lround((bullet->world_x + 0.5) * SUBPIXELS_PER_TILE);
+    h->bullet_cy[index] = (int)lround((bullet->world_y + 0.5) * SUBPIXELS_PER_TILE);
+}
+
+void hazard_sync_obstacles(Stage *stage)
+{
+    int count = (stage->num_obstacles + 3) & ~3;
+    if (count > MAX_OBSTACLES)
+        count = MAX_OBSTACLES;
+
+    for (int i = 0; i < count; ++i)
+        hazard_sync_obstacle(stage, i);
+    stage->hazards.obstacle_count = count;
+}
+
+void hazard_rebuild(Stage *stage)
+{
+    if (!stage)
+        return;
+
+    for (int i = 0; i < MAX_OBSTACLES; ++i)
+        hazard_sync_obstacle(stage, i);
+    hazard_sync_obstacles(stage);
+
+    for (int i = 0; i < MAX_PROFESSOR_CLONES; ++i)
+        hazard_sync_clone(stage, i);
+
+    for (int i = 0; i < MAX_PROFESSOR_BULLETS; ++i)
+        hazard_sync_bullet(stage, i);
+}
+
+// xs/ys[0..count) 중 [box_x, box_x+size) x [box_y, box_y+size) 안에 든 점의 비트마스크
+// count는 4의 배수, 배열은 16바이트 정렬
+static uint64_t points_in_box(const int *xs, const int *ys, int count, int box_x, int box_y, int size)
+{
+    uint64_t mask = 0;
+
+#if defined(__SSE2__)
+    const __m128i bx = _mm_set1_epi32(box_x);
+    const __m128i by = _mm_set1_epi32(box_y);
+    const __m128i lo = _mm_set1_epi32(-1);
+    const __m128i hi = _mm_set1_epi32(size);
+
+    for (int i = 0; i < count; i += 4)
+    {
+        __m128i dx = _mm_sub_epi32(_mm_load_si128((const __m128i *)(xs + i)), bx);
+        __m128i dy = _mm_sub_epi32(_mm_load_si128((const __m128i *)(ys + i)), by);
+        __m128i in_x = _mm_and_si128(_mm_cmpgt_epi32(dx, lo), _mm_cmplt_epi32(dx, hi));
+        __m128i in_y = _mm_and_si128(_mm_cmpgt_epi32(dy, lo), _mm_cmplt_epi32(dy, hi));
+        int bits = _mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(in_x, in_y)));
+        mask |= (uint64_t)bits << i;
+    }
+#else
+    for (int i = 0; i < count; ++i)
+    {
+        int dx = xs[i] - box_x;
+        int dy = ys[i] - box_y;
+        if (dx >= 0 && dx < size && dy >= 0 && dy < size)
+            mask |= (uint64_t)1 << i;
+    }
+#endif
+
+    return mask;
+}
+
+uint64_t hazard_obstacle_hits(const Stage *stage, const Player *player)
+{
+    const HazardSoA *h = &stage->hazards;
+    return points_in_box(h->obstacle_cx, h->obstacle_cy, h->obstacle_count,
+                         player->world_x, player->world_y, SUBPIXELS_PER_TILE);
+}
+
+uint64_t hazard_clone_hits(const Stage *stage, const Player *player)
+{
+    const HazardSoA *h = &stage->hazards;
+    return points_in_box(h->clone_cx, h->clone_cy, MAX_PROFESSOR_CLONES,
+                         player->world_x, player->world_y, SUBPIXELS_PER_TILE);
+}
+
+uint64_t hazard_bullet_hits(const Stage *stage, const Player *player)
+{
+    const HazardSoA *h = &stage->hazards;
+    return points_in_box(h->bullet_cx, h->bullet_cy, MAX_PROFESSOR_BULLETS,
+                         player->world_x, player->world_y, SUBPIXELS_PER_TILE);
+}
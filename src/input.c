@@ -22,6 +22,10 @@ static char g_direction_stack[4];
 static int g_direction_count = 0;
 static int g_direction_down[4] = {0};
 
+// 창 상태 (메뉴 화면 저전력 대기용)
+static int g_window_hidden = 0;
+static int g_window_unfocused = 0;
+
 static void remove_direction(char dir)
 {
     for (int i = 0; i < g_direction_count; ++i)
@@ -98,6 +102,8 @@ static int translate_key(SDL_Keycode key)
         case SDLK_q:
         case SDLK_ESCAPE:
             return 'q';
+        case SDLK_F3:
+            return INPUT_KEY_TOGGLE_PERF_OVERLAY;
         default:
             return (key >= 0 && key < 128) ? (int)key : -1;
     }
@@ -113,31 +119,113 @@ void restore_input(void)
     SDL_StopTextInput();
 }
 
+// 이벤트 하나 처리: 키 입력이면 매핑된 키, 아니면 -1
+// - 창 노출/복원/크기 변경이면 *needs_redraw를 1로 설정
+static int process_event(const SDL_Event *event, int *needs_redraw)
+{
+    if (event->type == SDL_QUIT)
+    {
+        g_running = 0;
+        return -1;
+    }
+
+    if (event->type == SDL_WINDOWEVENT)
+    {
+        switch (event->window.event)
+        {
+        case SDL_WINDOWEVENT_HIDDEN:
+        case SDL_WINDOWEVENT_MINIMIZED:
+            g_window_hidden = 1;
+            break;
+        case SDL_WINDOWEVENT_SHOWN:
+        case SDL_WINDOWEVENT_RESTORED:
+        case SDL_WINDOWEVENT_MAXIMIZED:
+            g_window_hidden = 0;
+            if (needs_redraw)
+                *needs_redraw = 1;
+            break;
+        case SDL_WINDOWEVENT_EXPOSED:
+        case SDL_WINDOWEVENT_SIZE_CHANGED:
+            if (needs_redraw)
+                *needs_redraw = 1;
+            break;
+        case SDL_WINDOWEVENT_FOCUS_LOST:
+            g_window_unfocused = 1;
+            break;
+        case SDL_WINDOWEVENT_FOCUS_GAINED:
+            g_window_unfocused = 0;
+            break;
+        default:
+            break;
+        }
+        return -1;
+    }
+
+    if (event->type == SDL_KEYDOWN && !event->key.repeat)
+    {
+        return translate_key(event->key.keysym.sym);
+    }
+
+    return -1;
+}
+
 int read_input(void)
 {
     sync_direction_state();
     SDL_Event event;
     while (SDL_PollEvent(&event))
     {
-        if (event.type == SDL_QUIT)
+        int mapped = process_event(&event, NULL);
+        if (mapped != -1)
+        {
+            return mapped;
+        }
+        if (!g_running)
         {
-            g_running = 0;
             return -1;
         }
+    }
+
+    return -1;
+}
+
+int wait_input(int timeout_ms, int *needs_redraw)
+{
+    SDL_Event event;
+    if (!SDL_WaitEventTimeout(&event, timeout_ms))
+    {
+        return -1;
+    }
 
-        if (event.type == SDL_KEYDOWN && !event.key.repeat)
+    // 깨어난 김에 쌓인 이벤트를 마저 처리 (키를 찾으면 나머지는 큐에 남겨 둠)
+    do
+    {
+        int mapped = process_event(&event, needs_redraw);
+        if (mapped != -1)
         {
-            int mapped = translate_key(event.key.keysym.sym);
-            if (mapped != -1)
-            {
-                return mapped;
-            }
+            sync_direction_state();
+            return mapped;
         }
-    }
+        if (!g_running)
+        {
+            return -1;
+        }
+    } while (SDL_PollEvent(&event));
 
+    sync_direction_state();
     return -1;
 }
 
+int input_window_is_idle(void)
+{
+    return g_window_hidden || g_window_unfocused;
+}
+
+int input_window_is_hidden(void)
+{
+    return g_window_hidden;
+}
+
 int poll_input(void)
 {
     return read_input();
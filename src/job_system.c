@@ -0,0 +1,308 @@
+#define _DEFAULT_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../include/job_system.h"
+#include "../include/trace.h"
+
+#define JOB_DEQUE_SIZE 256 // 2의 거듭제곱. 반씩 쪼개므로 깊이는 log2(count) 정도
+
+typedef struct
+{
+    atomic_int remaining; // 아직 끝나지 않은 항목 수
+} JobGroup;
+
+typedef struct
+{
+    JobRangeFunc fn;
+    void *ctx;
+    int begin;
+    int end;
+    int grain;
+    JobGroup *group;
+} Job;
+
+// Chase-Lev 덱 (Lê et al. 2013의 C11 메모리 순서)
+typedef struct
+{
+    atomic_long top;
+    atomic_long bottom;
+    Job jobs[JOB_DEQUE_SIZE];
+} JobDeque;
+
+typedef struct
+{
+    pthread_t thread;
+    int index;
+    unsigned int steal_seed;
+    JobDeque deque;
+} JobWorker;
+
+static JobWorker g_workers[JOB_MAX_WORKERS];
+static int g_worker_count = 1;
+static int g_started = 0;
+
+static atomic_int g_shutdown = 0;
+static atomic_int g_active_groups = 0;
+static pthread_mutex_t g_wake_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_wake_cond = PTHREAD_COND_INITIALIZER;
+static unsigned long g_wake_generation = 0;
+
+static void deque_reset(JobDeque *dq)
+{
+    atomic_store(&dq->top, 0);
+    atomic_store(&dq->bottom, 0);
+}
+
+// 주인만 호출. 가득 차면 0
+static int deque_push(JobDeque *dq, const Job *job)
+{
+    long b = atomic_load_explicit(&dq->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&dq->top, memory_order_acquire);
+    if (b - t >= JOB_DEQUE_SIZE)
+        return 0;
+
+    dq->jobs[b & (JOB_DEQUE_SIZE - 1)] = *job;
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+    return 1;
+}
+
+// 주인만 호출. 비었으면 0
+static int deque_pop(JobDeque *dq, Job *out)
+{
+    long b = atomic_load_explicit(&dq->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&dq->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long t = atomic_load_explicit(&dq->top, memory_order_relaxed);
+
+    if (t > b)
+    {
+        atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+        return 0;
+    }
+
+    *out = dq->jobs[b & (JOB_DEQUE_SIZE - 1)];
+    if (t == b)
+    {
+        // 마지막 하나: 훔치는 쪽과 경쟁
+        int won = atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+                                                          memory_order_seq_cst, memory_order_relaxed);
+        atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+        return won;
+    }
+    return 1;
+}
+
+// 다른 워커가 호출. 비었거나 경쟁에서 지면 0
+static int deque_steal(JobDeque *dq, Job *out)
+{
+    long t = atomic_load_explicit(&dq->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long b = atomic_load_explicit(&dq->bottom, memory_order_acquire);
+    if (t >= b)
+        return 0;
+
+    Job job = dq->jobs[t & (JOB_DEQUE_SIZE - 1)];
+    if (!atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed))
+        return 0;
+
+    *out = job;
+    return 1;
+}
+
+// 범위가 grain보다 크면 오른쪽 절반을 덱에 넣고 왼쪽으로 계속 진행
+static void run_job(JobWorker *self, Job job)
+{
+    while (job.end - job.begin > job.grain)
+    {
+        int mid = job.begin + (job.end - job.begin) / 2;
+        Job right = job;
+        right.begin = mid;
+        if (!deque_push(&self->deque, &right))
+            break; // 덱이 가득 차면 남은 범위를 그냥 직접 처리
+        job.end = mid;
+    }
+
+    job.fn(job.ctx, job.begin, job.end, self->index);
+    atomic_fetch_sub_explicit(&job.group->remaining, job.end - job.begin, memory_order_acq_rel);
+}
+
+static int try_get_job(JobWorker *self, Job *out)
+{
+    if (deque_pop(&self->deque, out))
+        return 1;
+
+    if (g_worker_count <= 1)
+        return 0;
+
+    // 임의의 피해자부터 한 바퀴
+    unsigned int x = self->steal_seed; // xorshift32
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    self->steal_seed = x;
+    int start = (int)(x % (unsigned)g_worker_count);
+    for (int i = 0; i < g_worker_count; ++i)
+    {
+        int victim = (start + i) % g_worker_count;
+        if (victim == self->index)
+            continue;
+        if (deque_steal(&g_workers[victim].deque, out))
+            return 1;
+    }
+    return 0;
+}
+
+static void *worker_thread_main(void *arg)
+{
+    JobWorker *self = (JobWorker *)arg;
+    unsigned long seen_generation = 0;
+    trace_thread_name("job worker");
+
+    while (!atomic_load(&g_shutdown))
+    {
+        Job job;
+        if (try_get_job(self, &job))
+        {
+            run_job(self, job);
+            continue;
+        }
+
+        if (atomic_load(&g_active_groups) > 0)
+        {
+            sched_yield();
+            continue;
+        }
+
+        // 할 일이 없으면 다음 parallel_for까지 잠듦
+        pthread_mutex_lock(&g_wake_mutex);
+        while (!atomic_load(&g_shutdown) && g_wake_generation == seen_generation &&
+               atomic_load(&g_active_groups) == 0)
+        {
+            pthread_cond_wait(&g_wake_cond, &g_wake_mutex);
+        }
+        seen_generation = g_wake_generation;
+        pthread_mutex_unlock(&g_wake_mutex);
+    }
+    return NULL;
+}
+
+int job_system_init(int num_threads)
+{
+    if (g_started)
+        return 0;
+
+    if (num_threads <= 0)
+    {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = (cores > 0) ? (int)cores : 1;
+    }
+    if (num_threads > JOB_MAX_WORKERS)
+        num_threads = JOB_MAX_WORKERS;
+
+    atomic_store(&g_shutdown, 0);
+    atomic_store(&g_active_groups, 0);
+
+    for (int i = 0; i < JOB_MAX_WORKERS; ++i)
+    {
+        g_workers[i].index = i;
+        g_workers[i].steal_seed = 0x9e3779b9u * (unsigned)(i + 1);
+        deque_reset(&g_workers[i].deque);
+    }
+
+    // 워커 0은 parallel_for를 호출한 스레드
+    g_worker_count = 1;
+    for (int i = 1; i < num_threads; ++i)
+    {
+        if (pthread_create(&g_workers[i].thread, NULL, worker_thread_main, &g_workers[i]) != 0)
+        {
+            fprintf(stderr, "잡 워커 스레드 생성 실패 (%d개로 진행)\n", g_worker_count);
+            break;
+        }
+        g_worker_count++;
+    }
+
+    g_started = 1;
+    return 0;
+}
+
+void job_system_shutdown(void)
+{
+    if (!g_started)
+        return;
+
+    pthread_mutex_lock(&g_wake_mutex);
+    atomic_store(&g_shutdown, 1);
+    pthread_cond_broadcast(&g_wake_cond);
+    pthread_mutex_unlock(&g_wake_mutex);
+
+    for (int i = 1; i < g_worker_count; ++i)
+    {
+        pthread_join(g_workers[i].thread, NULL);
+    }
+
+    g_worker_count = 1;
+    g_started = 0;
+}
+
+int job_system_restart(int num_threads)
+{
+    job_system_shutdown();
+    return job_system_init(num_threads);
+}
+
+int job_system_worker_count(void)
+{
+    return g_worker_count;
+}
+
+void job_system_parallel_for(int count, int grain, JobRangeFunc fn, void *ctx)
+{
+    if (count <= 0 || !fn)
+        return;
+    if (grain < 1)
+        grain = 1;
+
+    // 워커가 없거나 한 조각이면 바로 실행
+    if (!g_started || g_worker_count <= 1 || count <= grain)
+    {
+        fn(ctx, 0, count, 0);
+        return;
+    }
+
+    JobGroup group;
+    atomic_init(&group.remaining, count);
+
+    JobWorker *self = &g_workers[0];
+    Job root = {fn, ctx, 0, count, grain, &group};
+
+    atomic_fetch_add(&g_active_groups, 1);
+    pthread_mutex_lock(&g_wake_mutex);
+    g_wake_generation++;
+    pthread_cond_broadcast(&g_wake_cond);
+    pthread_mutex_unlock(&g_wake_mutex);
+
+    run_job(self, root);
+
+    // 남은 조각은 내 덱에서 꺼내거나 훔쳐 와서 같이 처리
+    while (atomic_load_explicit(&group.remaining, memory_order_acquire) > 0)
+    {
+        Job job;
+        if (try_get_job(self, &job))
+        {
+            run_job(self, job);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    atomic_fetch_sub(&g_active_groups, 1);
+}
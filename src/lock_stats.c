@@ -0,0 +1,134 @@
+#include <time.h>
+
+#include "../include/lock_stats.h"
+#include "../include/trace.h"
+
+static uint64_t monotonic_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static int bucket_for_ns(uint64_t ns)
+{
+    uint64_t limit = 1000; // 1us
+    for (int i = 0; i < LOCK_STATS_BUCKETS - 1; ++i)
+    {
+        if (ns < limit)
+            return i;
+        limit *= 4;
+    }
+    return LOCK_STATS_BUCKETS - 1;
+}
+
+double lock_stats_bucket_limit_us(int bucket)
+{
+    double limit = 1.0;
+    for (int i = 0; i < bucket; ++i)
+        limit *= 4.0;
+    return limit;
+}
+
+static void record_sample(atomic_ulong *total, atomic_ulong *max, atomic_ulong *hist, uint64_t ns)
+{
+    // 락 보유자만 쓰므로 읽고-쓰기를 나눠도 됨
+    atomic_store_explicit(total, atomic_load_explicit(total, memory_order_relaxed) + ns, memory_order_relaxed);
+    if (ns > atomic_load_explicit(max, memory_order_relaxed))
+        atomic_store_explicit(max, ns, memory_order_relaxed);
+    atomic_ulong *bucket = &hist[bucket_for_ns(ns)];
+    atomic_store_explicit(bucket, atomic_load_explicit(bucket, memory_order_relaxed) + 1, memory_order_relaxed);
+}
+
+void instrumented_lock(InstrumentedMutex *m, int site)
+{
+    if (site < 0 || site >= LOCK_STATS_MAX_SITES)
+        site = 0;
+
+    uint64_t wait_start = monotonic_ns();
+    int contended = 0;
+    if (pthread_mutex_trylock(&m->mutex) != 0)
+    {
+        contended = 1;
+        pthread_mutex_lock(&m->mutex);
+    }
+    uint64_t acquired = monotonic_ns();
+
+    LockSiteStats *s = &m->sites[site];
+    atomic_store_explicit(&s->acquisitions, atomic_load_explicit(&s->acquisitions, memory_order_relaxed) + 1,
+                          memory_order_relaxed);
+    if (contended)
+        atomic_store_explicit(&s->contended, atomic_load_explicit(&s->contended, memory_order_relaxed) + 1,
+                              memory_order_relaxed);
+    record_sample(&s->wait_total_ns, &s->wait_max_ns, s->wait_hist, acquired - wait_start);
+
+    if (trace_enabled())
+        trace_end(s->name ? s->name : m->name, "lock wait", wait_start);
+
+    m->holder_site = site;
+    m->hold_start_ns = acquired;
+}
+
+void instrumented_unlock(InstrumentedMutex *m)
+{
+    LockSiteStats *s = &m->sites[m->holder_site];
+    uint64_t hold_start = m->hold_start_ns;
+    record_sample(&s->hold_total_ns, &s->hold_max_ns, s->hold_hist, monotonic_ns() - hold_start);
+
+    pthread_mutex_unlock(&m->mutex);
+
+    if (trace_enabled())
+        trace_end(s->name ? s->name : m->name, "lock hold", hold_start);
+}
+
+void instrumented_mutex_snapshot(const InstrumentedMutex *m, int site, LockSiteSnapshot *out)
+{
+    const LockSiteStats *s = &m->sites[site];
+    unsigned long count = atomic_load_explicit(&s->acquisitions, memory_order_relaxed);
+
+    out->name = s->name;
+    out->acquisitions = count;
+    out->contended = atomic_load_explicit(&s->contended, memory_order_relaxed);
+    out->wait_avg_us = count ? atomic_load_explicit(&s->wait_total_ns, memory_order_relaxed) / 1000.0 / count : 0.0;
+    out->wait_max_us = atomic_load_explicit(&s->wait_max_ns, memory_order_relaxed) / 1000.0;
+    out->hold_avg_us = count ? atomic_load_explicit(&s->hold_total_ns, memory_order_relaxed) / 1000.0 / count : 0.0;
+    out->hold_max_us = atomic_load_explicit(&s->hold_max_ns, memory_order_relaxed) / 1000.0;
+    for (int i = 0; i < LOCK_STATS_BUCKETS; ++i)
+    {
+        out->wait_hist[i] = atomic_load_explicit(&s->wait_hist[i], memory_order_relaxed);
+        out->hold_hist[i] = atomic_load_explicit(&s->hold_hist[i], memory_order_relaxed);
+    }
+}
+
+static void print_histogram(FILE *out, const char *label, const unsigned long *hist)
+{
+    fprintf(out, "    %s:", label);
+    for (int i = 0; i < LOCK_STATS_BUCKETS; ++i)
+    {
+        if (i < LOCK_STATS_BUCKETS - 1)
+            fprintf(out, " <%gus=%lu", lock_stats_bucket_limit_us(i), hist[i]);
+        else
+            fprintf(out, " >=%gus=%lu", lock_stats_bucket_limit_us(i - 1), hist[i]);
+    }
+    fprintf(out, "\n");
+}
+
+void instrumented_mutex_report(const InstrumentedMutex *m, FILE *out)
+{
+    fprintf(out, "락 통계 (%s):\n", m->name);
+    for (int site = 0; site < LOCK_STATS_MAX_SITES; ++site)
+    {
+        LockSiteSnapshot snap;
+        instrumented_mutex_snapshot(m, site, &snap);
+        if (!snap.name)
+            continue;
+
+        fprintf(out, "  [%s] 획득 %lu회, 경합 %lu회, 대기 평균 %.1fus / 최대 %.1fus, 점유 평균 %.1fus / 최대 %.1fus\n",
+                snap.name, snap.acquisitions, snap.contended, snap.wait_avg_us, snap.wait_max_us,
+                snap.hold_avg_us, snap.hold_max_us);
+        if (snap.acquisitions == 0)
+            continue;
+        print_histogram(out, "대기", snap.wait_hist);
+        print_histogram(out, "점유", snap.hold_hist);
+    }
+}
@@ -0,0 +1,172 @@
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "../include/log.h"
+
+#define LOG_RING_SIZE 256       // 2의 거듭제곱
+#define LOG_MESSAGE_MAX 160
+#define LOG_DRAIN_INTERVAL_NS 5000000L // 드레인 스레드 주기 5ms
+
+// 다중 생산자 링 (슬롯별 순번 방식)
+// - 생산자: tail을 CAS로 예약 -> 내용 기록 -> sequence = 위치 + 1로 공개
+// - 소비자: sequence가 위치 + 1인 슬롯만 읽고 sequence = 위치 + 크기로 재사용 허가
+typedef struct
+{
+    atomic_uint sequence;
+    unsigned char level;
+    unsigned char category;
+    char text[LOG_MESSAGE_MAX];
+} LogSlot;
+
+static LogSlot g_slots[LOG_RING_SIZE];
+static atomic_uint g_tail;
+static unsigned g_head; // g_drain_mutex 보호
+static atomic_uint g_dropped;
+static atomic_int g_ring_ready;
+
+static pthread_mutex_t g_drain_mutex = PTHREAD_MUTEX_INITIALIZER; // 소비자끼리만 (생산자는 안 잡음)
+static pthread_t g_drain_thread;
+static atomic_int g_drain_running;
+
+static const char *kLevelNames[] = {"debug", "info", "warn", "error"};
+static const char *kCategoryNames[LOG_CAT_COUNT] = {"game", "sim", "pattern", "stage"};
+
+static void ring_init_once(void)
+{
+    int expected = 0;
+    if (!atomic_compare_exchange_strong(&g_ring_ready, &expected, 1))
+        return;
+    for (unsigned i = 0; i < LOG_RING_SIZE; ++i)
+        atomic_store_explicit(&g_slots[i].sequence, i, memory_order_relaxed);
+    atomic_store_explicit(&g_ring_ready, 2, memory_order_release);
+}
+
+static void emit_line(int level, int category, const char *text)
+{
+    // 진행 메시지(info)는 원래 printf 출력과 같은 모양, 나머지는 수준/분류 머리말
+    if (level == LOG_LEVEL_INFO)
+    {
+        printf("%s\n", text);
+        return;
+    }
+    FILE *out = (level >= LOG_LEVEL_WARN) ? stderr : stdout;
+    fprintf(out, "[%s][%s] %s\n", kLevelNames[level], kCategoryNames[category], text);
+}
+
+static void drain_locked(void)
+{
+    int wrote = 0;
+    while (1)
+    {
+        LogSlot *slot = &g_slots[g_head & (LOG_RING_SIZE - 1)];
+        unsigned seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        if (seq != g_head + 1)
+            break;
+
+        emit_line(slot->level, slot->category, slot->text);
+        atomic_store_explicit(&slot->sequence, g_head + LOG_RING_SIZE, memory_order_release);
+        g_head++;
+        wrote = 1;
+    }
+
+    unsigned dropped = atomic_exchange_explicit(&g_dropped, 0, memory_order_relaxed);
+    if (dropped > 0)
+    {
+        fprintf(stderr, "[warn][log] 로그 링이 가득 차 메시지 %u개를 버렸습니다.\n", dropped);
+    }
+    if (wrote)
+        fflush(stdout);
+}
+
+void log_flush(void)
+{
+    if (atomic_load_explicit(&g_ring_ready, memory_order_acquire) != 2)
+        return;
+    pthread_mutex_lock(&g_drain_mutex);
+    drain_locked();
+    pthread_mutex_unlock(&g_drain_mutex);
+}
+
+static void *drain_thread_main(void *arg)
+{
+    (void)arg;
+    const struct timespec interval = {.tv_sec = 0, .tv_nsec = LOG_DRAIN_INTERVAL_NS};
+    while (atomic_load_explicit(&g_drain_running, memory_order_acquire))
+    {
+        log_flush();
+        nanosleep(&interval, NULL);
+    }
+    return NULL;
+}
+
+int log_init(void)
+{
+    ring_init_once();
+    if (atomic_load(&g_drain_running))
+        return 0;
+
+    atomic_store(&g_drain_running, 1);
+    if (pthread_create(&g_drain_thread, NULL, drain_thread_main, NULL) != 0)
+    {
+        atomic_store(&g_drain_running, 0);
+        return -1;
+    }
+    return 0;
+}
+
+void log_shutdown(void)
+{
+    if (atomic_exchange(&g_drain_running, 0))
+    {
+        pthread_join(g_drain_thread, NULL);
+    }
+    log_flush();
+}
+
+void log_write(LogLevel level, LogCategory category, const char *fmt, ...)
+{
+    ring_init_once();
+    while (atomic_load_explicit(&g_ring_ready, memory_order_acquire) != 2)
+        ; // 다른 스레드가 초기화 중 (최초 한 번, 슬롯 256개)
+
+    unsigned pos = atomic_load_explicit(&g_tail, memory_order_relaxed);
+    LogSlot *slot;
+    while (1)
+    {
+        slot = &g_slots[pos & (LOG_RING_SIZE - 1)];
+        unsigned seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int diff = (int)(seq - pos);
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&g_tail, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            atomic_fetch_add_explicit(&g_dropped, 1, memory_order_relaxed);
+            return; // 가득 참
+        }
+        else
+        {
+            pos = atomic_load_explicit(&g_tail, memory_order_relaxed);
+        }
+    }
+
+    slot->level = (unsigned char)level;
+    slot->category = (unsigned char)category;
+
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(slot->text, sizeof(slot->text), fmt, args);
+    va_end(args);
+
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+
+    // 드레인 스레드가 없으면 (벤치마크, 시작 전) 바로 출력
+    if (!atomic_load_explicit(&g_drain_running, memory_order_relaxed))
+        log_flush();
+}
@@ -3,25 +3,31 @@
 #include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/time.h>
 #include <time.h>
 #include <unistd.h>
 
+#include "../include/bench.h"
 #include "../include/fileio.h"
+#include "../include/frame_pacer.h"
 #include "../include/game.h"
 #include "../include/input.h"
+#include "../include/job_system.h"
+#include "../include/log.h"
 #include "../include/obstacle.h"
 #include "../include/player.h"
 #include "../include/professor_pattern.h"
 #include "../include/projectile.h"
 #include "../include/render.h"
+#include "../include/render_bench.h"
 #include "../include/signal_handler.h"
+#include "../include/simulation.h"
 #include "../include/sound.h"
 #include "../include/stage.h"
 #include "../include/timer.h"
-
-extern int is_goal_reached(const Stage *stage, const Player *player);
-extern int check_collision(Stage *stage, Player *player);
+#include "../include/trace.h"
+#include "../include/world_state.h"
 
 typedef enum
 {
@@ -59,11 +65,6 @@ typedef struct
     const char *no_item_sound_path;
 } SoundAssets;
 
-static const double kScooterDurationSec = 20.0;
-static const double kWalkSfxIntervalBaseSec = 0.45;
-static const double kWalkSfxIntervalScooterSec = 0.25;
-static double g_last_walk_sfx_time = 0.0;
-
 static int run_title_menu(void);
 static void run_records_view(void);
 static void run_game_over_view(void);
@@ -73,45 +74,92 @@ static GameplayOutcome run_campaign(int start_stage_id,
                                     int playing_full_campaign,
                                     const SoundAssets *sounds);
 static void drain_pending_input(void);
+static void publish_perf_stats(double stage_load_ms);
+static void handle_sim_event(const SimEvent *ev, const SoundAssets *sounds);
+typedef struct
+{
+    const char *map_arg;      // 지정한 맵 파일 (없으면 전체 캠페인)
+    int sim_threads;          // 잡 워커 수 (0이면 코어 수)
+    int bench_obstacle_ticks; // 0보다 크면 장애물 벤치마크만 실행
+    const char *trace_path;   // 트레이스 JSON 저장 경로 (없으면 GAME_TRACE 환경 변수)
+    int bench_render_frames;  // 0보다 크면 오프스크린 렌더 벤치마크만 실행
+    RenderBenchOptions render_bench;
+    const char *capture_path; // 플레이 영상 녹화 파일 (.y4m 또는 raw)
+    int capture_fps;
+} CommandLineOptions;
+
+static int parse_command_line(int argc, char *argv[], CommandLineOptions *options);
+
+// 게임 루프 프레임 페이서 (--fps-cap, --uncapped)
+static FramePacerConfig g_pacer_config = {0};
+static FramePacer g_frame_pacer;
+static void setup_frame_pacer(void);
+static void report_frame_pacing(void);
+
+// 시작 지표: 실행부터 첫 타이틀 화면 표시까지(time-to-first-frame), 모든 에셋이 텍스처가 될 때까지
+static struct timespec g_process_start_ts;
+static void report_startup_metrics(void);
 
 int main(int argc, char *argv[])
 {
-    setup_signal_handlers();
-    init_sound_system();
-
-    if (init_renderer() != 0)
+    clock_gettime(CLOCK_MONOTONIC, &g_process_start_ts);
+    CommandLineOptions options = {0};
+    if (parse_command_line(argc, argv, &options) != 0)
     {
-        fprintf(stderr, "Failed to initialize renderer\n");
         return 1;
     }
+    const char *map_arg = options.map_arg;
 
-    init_input();
+    // 스레드를 만들기 전에 켜야 각 스레드가 자기 트랙을 등록함
+    trace_init(options.trace_path);
 
-    SoundAssets sounds = {
-        .bgm_file_path = "bgm/BGM.wav",
-        .gameover_bgm_path = "bgm/bgm_GameOut.wav",
-        .item_sound_path = "bgm/Get_Item.wav",
-        .item_use_sound_path = "bgm/Use_Item.wav",
-        .next_level_sound_path = "bgm/Next_Level.wav",
-        .bag_acquire_sound_path = "bgm/Get_Bag.wav",
-        .walking_sound_path = "bgm/Walking.wav",
-        .no_item_sound_path = "bgm/No_Item.wav"};
+    if (options.bench_obstacle_ticks > 0)
+    {
+        int bench_stage_id = map_arg ? find_stage_id_by_filename(map_arg) : get_stage_count();
+        if (bench_stage_id < 0)
+        {
+            fprintf(stderr, "알 수 없는 맵 파일: %s\n", map_arg);
+            trace_shutdown();
+            return 1;
+        }
+        int max_threads = (options.sim_threads > 0) ? options.sim_threads : JOB_MAX_WORKERS;
+        int bench_result = run_obstacle_benchmark(bench_stage_id, max_threads, options.bench_obstacle_ticks);
+        trace_shutdown();
+        return bench_result;
+    }
 
+    if (options.bench_render_frames > 0)
+    {
+        int bench_stage_id = map_arg ? find_stage_id_by_filename(map_arg) : get_stage_count();
+        if (bench_stage_id < 0)
+        {
+            fprintf(stderr, "알 수 없는 맵 파일: %s\n", map_arg);
+            trace_shutdown();
+            return 1;
+        }
+        job_system_init(options.sim_threads);
+        options.render_bench.frames = options.bench_render_frames;
+        int bench_result = run_render_benchmark(bench_stage_id, &options.render_bench);
+        job_system_shutdown();
+        trace_shutdown();
+        return bench_result;
+    }
+
+    // 녹화/스레드를 시작하기 전에 맵 인자를 확인해야 실패해도 정리할 것이 없음
     const int available_stage_count = get_stage_count();
     int start_stage_id = 1;
     int end_stage_id = available_stage_count;
     int stages_to_play = available_stage_count;
     int playing_full_campaign = 1;
 
-    if (argc >= 2)
+    if (map_arg)
     {
-        int requested_stage_id = find_stage_id_by_filename(argv[1]);
+        int requested_stage_id = find_stage_id_by_filename(map_arg);
         if (requested_stage_id < 0)
         {
-            fprintf(stderr, "알 수 없는 맵 파일: %s\n", argv[1]);
+            fprintf(stderr, "알 수 없는 맵 파일: %s\n", map_arg);
             fprintf(stderr, "assets/ 디렉토리에 존재하는 .map 파일명을 인자로 넘겨주세요.\n");
-            restore_input();
-            shutdown_renderer();
+            trace_shutdown();
             return 1;
         }
 
@@ -119,9 +167,43 @@ int main(int argc, char *argv[])
         end_stage_id = requested_stage_id;
         stages_to_play = 1;
         playing_full_campaign = 0;
-        printf("지정된 맵(%s)만 플레이합니다.\n", argv[1]);
+        printf("지정된 맵(%s)만 플레이합니다.\n", map_arg);
+    }
+
+    job_system_init(options.sim_threads);
+    log_init();
+
+    setup_signal_handlers();
+    init_sound_system();
+
+    if (init_renderer() != 0)
+    {
+        fprintf(stderr, "Failed to initialize renderer\n");
+        // 에셋 디코딩이 작업 풀을 쓰므로 스레드는 렌더러보다 먼저 시작함. 정상 종료와 같은 순서로 정리
+        job_system_shutdown();
+        log_shutdown();
+        trace_shutdown();
+        return 1;
+    }
+    setup_frame_pacer();
+
+    if (options.capture_path && render_start_capture(options.capture_path, options.capture_fps) != 0)
+    {
+        fprintf(stderr, "녹화를 시작하지 못해 녹화 없이 실행합니다\n");
     }
 
+    init_input();
+
+    SoundAssets sounds = {
+        .bgm_file_path = "bgm/BGM.wav",
+        .gameover_bgm_path = "bgm/bgm_GameOut.wav",
+        .item_sound_path = "bgm/Get_Item.wav",
+        .item_use_sound_path = "bgm/Use_Item.wav",
+        .next_level_sound_path = "bgm/Next_Level.wav",
+        .bag_acquire_sound_path = "bgm/Get_Bag.wav",
+        .walking_sound_path = "bgm/Walking.wav",
+        .no_item_sound_path = "bgm/No_Item.wav"};
+
     AppState state = APP_STATE_TITLE;
     while (state != APP_STATE_EXIT && g_running)
     {
@@ -193,19 +275,78 @@ int main(int argc, char *argv[])
     stop_bgm();
     restore_input();
     shutdown_renderer();
+    job_system_shutdown();
+    log_shutdown();
+    report_stage_lock_stats();
+    report_frame_pacing();
+    trace_shutdown();
     return 0;
 }
 
+static double ms_since_process_start(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec - g_process_start_ts.tv_sec) * 1000.0 +
+           (double)(now.tv_nsec - g_process_start_ts.tv_nsec) / 1e6;
+}
+
+// 첫 화면을 그린 뒤부터 호출 (각 지표는 한 번만 출력)
+static void report_startup_metrics(void)
+{
+    static int first_frame_reported = 0;
+    static int assets_ready_reported = 0;
+    if (!first_frame_reported)
+    {
+        printf("첫 화면까지: %.1f ms\n", ms_since_process_start());
+        first_frame_reported = 1;
+    }
+    if (!assets_ready_reported && render_assets_pending() == 0)
+    {
+        printf("에셋 로딩 완료까지: %.1f ms\n", ms_since_process_start());
+        assets_ready_reported = 1;
+    }
+}
+
+// 메뉴 화면은 애니메이션이 없으므로 입력/창 노출 때만 다시 그림.
+// 대기 시간 초과는 시그널(Ctrl+C)로 g_running이 바뀐 것을 확인하기 위한 것이고,
+// 창이 숨겨졌거나 포커스를 잃으면 더 길게 잠.
+// 에셋 디코딩이 진행 중이면 짧게 깨어나 끝난 이미지를 텍스처로 만들고, 새 텍스처가 생기면 다시 그림.
+#define MENU_WAIT_ACTIVE_MS 250
+#define MENU_WAIT_IDLE_MS 1000
+#define MENU_WAIT_LOADING_MS 10
+
+static int wait_menu_input(int *needs_redraw)
+{
+    int timeout_ms = input_window_is_idle() ? MENU_WAIT_IDLE_MS : MENU_WAIT_ACTIVE_MS;
+    if (render_assets_pending() > 0)
+    {
+        timeout_ms = MENU_WAIT_LOADING_MS;
+    }
+    int key = wait_input(timeout_ms, needs_redraw);
+    if (render_pump_assets() > 0)
+    {
+        *needs_redraw = 1;
+        report_startup_metrics();
+    }
+    return key;
+}
+
 static int run_title_menu(void)
 {
     int selection = TITLE_MENU_START;
+    int needs_redraw = 1;
     drain_pending_input();
     while (g_running)
     {
-        render_title_screen(selection);
-        SDL_Delay(16);
+        if (needs_redraw && !input_window_is_hidden())
+        {
+            render_title_screen(selection);
+            needs_redraw = 0;
+            report_startup_metrics();
+        }
 
-        int key = read_input();
+        int key = wait_menu_input(&needs_redraw);
         if (key == -1)
         {
             continue;
@@ -214,11 +355,13 @@ static int run_title_menu(void)
         if (key == 'w' || key == 'W')
         {
             selection = (selection + TITLE_MENU_COUNT - 1) % TITLE_MENU_COUNT;
+            needs_redraw = 1;
             continue;
         }
         if (key == 's' || key == 'S')
         {
             selection = (selection + 1) % TITLE_MENU_COUNT;
+            needs_redraw = 1;
             continue;
         }
         if (key == 'q' || key == 'Q')
@@ -236,12 +379,16 @@ static int run_title_menu(void)
 static void run_records_view(void)
 {
     double best_time = load_best_record();
+    int needs_redraw = 1;
     drain_pending_input();
     while (g_running)
     {
-        render_records_screen(best_time);
-        SDL_Delay(16);
-        if (read_input() != -1)
+        if (needs_redraw && !input_window_is_hidden())
+        {
+            render_records_screen(best_time);
+            needs_redraw = 0;
+        }
+        if (wait_menu_input(&needs_redraw) != -1)
         {
             break;
         }
@@ -250,12 +397,16 @@ static void run_records_view(void)
 
 static void run_game_over_view(void)
 {
+    int needs_redraw = 1;
     drain_pending_input();
     while (g_running)
     {
-        render_game_over_screen();
-        SDL_Delay(16);
-        if (read_input() != -1)
+        if (needs_redraw && !input_window_is_hidden())
+        {
+            render_game_over_screen();
+            needs_redraw = 0;
+        }
+        if (wait_menu_input(&needs_redraw) != -1)
         {
             break;
         }
@@ -273,6 +424,14 @@ static GameplayOutcome run_campaign(int start_stage_id,
         return GAMEPLAY_OUTCOME_ABORTED;
     }
 
+    // 타이틀에서 바로 시작하면 남은 에셋 디코딩을 여기서 기다림
+    if (render_finish_assets() != 0)
+    {
+        fprintf(stderr, "Failed to load textures\n");
+        return GAMEPLAY_OUTCOME_ABORTED;
+    }
+    report_startup_metrics();
+
     struct timeval global_start, global_end;
     gettimeofday(&global_start, NULL);
 
@@ -290,6 +449,9 @@ static GameplayOutcome run_campaign(int start_stage_id,
     {
         const int current_stage_display = stage_counter + 1;
         Stage stage;
+        struct timespec load_start_ts, load_end_ts;
+        clock_gettime(CLOCK_MONOTONIC, &load_start_ts);
+        render_prepare_stage(stage_id);
         if (load_stage(&stage, stage_id) != 0)
         {
             fprintf(stderr, "Failed to load stage %d\n", stage_id);
@@ -299,14 +461,27 @@ static GameplayOutcome run_campaign(int start_stage_id,
             break;
         }
 
+        clock_gettime(CLOCK_MONOTONIC, &load_end_ts);
+        double stage_load_ms = (double)(load_end_ts.tv_sec - load_start_ts.tv_sec) * 1000.0 +
+                               (double)(load_end_ts.tv_nsec - load_start_ts.tv_nsec) / 1e6;
+
         Player player;
         init_player(&player, &stage);
-        g_last_walk_sfx_time = 0.0;
+
+        // 렌더용 사본 (시뮬레이션 상태는 발행된 스냅샷으로 매 프레임 갱신)
+        static Stage view;
+        static Player player_view;
+        view = stage;
+        player_view = player;
+        simulation_begin_stage();
+        world_state_reset();
+        world_state_publish(&stage, &player);
 
         set_obstacle_player_ref(&player);
         if (start_obstacle_thread(&stage) != 0)
         {
             fprintf(stderr, "Failed to start obstacle thread\n");
+            unload_stage(&stage);
             stop_bgm();
             cleared_all = 0;
             failure_detected = 1;
@@ -315,207 +490,79 @@ static GameplayOutcome run_campaign(int start_stage_id,
 
         struct timeval stage_start, now;
         gettimeofday(&stage_start, NULL);
-        double previous_elapsed = 0.0;
+        int last_held_direction = -1;
 
         int stage_cleared = 0;
         int stage_failed = 0;
+        frame_pacer_restart(&g_frame_pacer);
 
         while (g_running)
         {
-            struct timespec frame_start_ts;
-            clock_gettime(CLOCK_MONOTONIC, &frame_start_ts);
+            uint64_t trace_frame = trace_begin();
 
             gettimeofday(&now, NULL);
             double elapsed = get_elapsed_time(stage_start, now);
-            double frame_delta = elapsed - previous_elapsed;
-            if (frame_delta < 0.0)
-            {
-                frame_delta = 0.0;
-            }
-            previous_elapsed = elapsed;
 
-            pthread_mutex_lock(&g_stage_mutex);
-            int move_finished = update_player_motion(&player, frame_delta);
-            if (!player.has_backpack &&
-                is_tile_center_inside_player(&player, stage.goal_x, stage.goal_y))
+            // 입력 → 플레이어 명령 (상태는 시뮬레이션 틱이 다음 틱에 반영)
+            int key = poll_input();
+            if (key == 'q' || key == 'Q')
             {
-                player.has_backpack = 1;
-                stage.map[stage.goal_y][stage.goal_x] = ' ';
-                play_sfx_nonblocking(sounds->bag_acquire_sound_path);
+                trace_end("frame", "main", trace_frame);
+                g_running = 0;
+                break;
             }
-            render(&stage, &player, elapsed, current_stage_display, stages_to_play);
-            pthread_mutex_unlock(&g_stage_mutex);
 
-            if (move_finished)
+            int held = current_direction_key();
+            if (held != last_held_direction)
             {
-                int held = current_direction_key();
-                if (held != -1)
+                PlayerCommand cmd = {.type = PLAYER_COMMAND_HOLD_DIRECTION, .key = held};
+                if (simulation_push_command(&cmd))
                 {
-                    pthread_mutex_lock(&g_stage_mutex);
-                    double walk_interval = player.has_scooter ? kWalkSfxIntervalScooterSec : kWalkSfxIntervalBaseSec;
-                    move_player(&player, (char)held, &stage, elapsed);
-                    if (elapsed - g_last_walk_sfx_time >= walk_interval)
-                    {
-                        play_sfx_nonblocking(sounds->walking_sound_path);
-                        g_last_walk_sfx_time = elapsed;
-                    }
-                    pthread_mutex_unlock(&g_stage_mutex);
+                    last_held_direction = held;
                 }
             }
 
-            pthread_mutex_lock(&g_stage_mutex);
-            int trap_triggered = check_trap_collision(&stage, &player);
-            if (trap_triggered && player.shield_count > 0)
+            if (key == 'k' || key == 'K' || key == ' ')
             {
-                player.shield_count--;
-                printf("쉴드로 방어 했습니다! 남은 쉴드: %d개\n", player.shield_count);
-                play_sfx_nonblocking(sounds->item_use_sound_path);
-                pthread_mutex_unlock(&g_stage_mutex);
-                continue;
+                PlayerCommand cmd = {.type = PLAYER_COMMAND_FIRE, .key = key};
+                simulation_push_command(&cmd);
             }
-
-            if (trap_triggered)
+            else if (key == INPUT_KEY_TOGGLE_PERF_OVERLAY)
             {
-                printf("트랩을 밟았습니다!\n");
-                stop_bgm();
-                const char *tts_game_out_command = "espeak -a 200 -v en-us+m5 -s 140 'Game Out!'";
-                fflush(stdout);
-                system(tts_game_out_command);
-                play_obstacle_caught_sound(sounds->gameover_bgm_path);
-                stage_failed = 1;
-                pthread_mutex_unlock(&g_stage_mutex);
-                break;
+                render_toggle_perf_overlay();
             }
-
-            if (check_collision(&stage, &player))
+            else if (key != -1)
             {
-                stop_bgm();
-                const char *tts_game_out_command = "espeak -a 200 -v en-us+m5 -s 140 'Game Out!'";
-                fflush(stdout);
-                system(tts_game_out_command);
-                play_obstacle_caught_sound(sounds->gameover_bgm_path);
-                stage_failed = 1;
-                pthread_mutex_unlock(&g_stage_mutex);
-                break;
+                PlayerCommand cmd = {.type = PLAYER_COMMAND_STEP, .key = key};
+                simulation_push_command(&cmd);
             }
 
-            if (is_goal_reached(&stage, &player))
+            // 발행된 스냅샷으로 렌더 (락 없음)
+            WorldTickTiming tick_timing;
+            world_state_read(&view, &player_view, &tick_timing);
+            render_set_tick_alpha(world_state_tick_alpha(&tick_timing));
+            publish_perf_stats(stage_load_ms);
+            uint64_t trace_render = trace_begin();
+            render(&view, &player_view, elapsed, current_stage_display, stages_to_play);
+            trace_end("render", "main", trace_render);
+
+            // 결과를 먼저 읽고 이벤트를 비워야 결과 직전 이벤트(트랩 메시지 등)를 놓치지 않음
+            SimOutcome outcome = simulation_get_outcome();
+            SimEvent ev;
+            while (simulation_poll_event(&ev))
             {
-                stage_cleared = 1;
-                pthread_mutex_unlock(&g_stage_mutex);
-                break;
+                handle_sim_event(&ev, sounds);
             }
-            pthread_mutex_unlock(&g_stage_mutex);
 
-            int key = poll_input();
-            if (key != -1)
-            {
-                if (key == 'q' || key == 'Q')
-                {
-                    g_running = 0;
-                    break;
-                }
-                if (key == 'k' || key == 'K' || key == ' ')
-                {
-                    pthread_mutex_lock(&g_stage_mutex);
-                    if (stage.remaining_ammo > 0)
-                    {
-                        fire_projectile(&stage, &player);
-                        play_sfx_nonblocking(sounds->item_use_sound_path);
-                    }
-                    else
-                    {
-                        play_sfx_nonblocking(sounds->no_item_sound_path);
-                    }
-                    pthread_mutex_unlock(&g_stage_mutex);
-                    continue;
-                }
+            // 아래 결과 처리는 루프를 빠져나가므로 프레임 구간을 먼저 닫음
+            trace_end("frame", "main", trace_frame);
 
-                pthread_mutex_lock(&g_stage_mutex);
-                move_player(&player, (char)key, &stage, elapsed);
-                double walk_interval = player.has_scooter ? kWalkSfxIntervalScooterSec : kWalkSfxIntervalBaseSec;
-                if (elapsed - g_last_walk_sfx_time >= walk_interval)
-                {
-                    play_sfx_nonblocking(sounds->walking_sound_path);
-                    g_last_walk_sfx_time = elapsed;
-                }
-                pthread_mutex_unlock(&g_stage_mutex);
-            }
-            else
+            if (outcome == SIM_OUTCOME_CLEARED)
             {
-                pthread_mutex_lock(&g_stage_mutex);
-                update_player_idle(&player, elapsed);
-                pthread_mutex_unlock(&g_stage_mutex);
-            }
-
-            pthread_mutex_lock(&g_stage_mutex);
-            for (int i = 0; i < stage.num_items; i++)
-            {
-                Item *it = &stage.items[i];
-                if (!it->active)
-                {
-                    continue;
-                }
-
-                int item_tile_x = it->world_x / SUBPIXELS_PER_TILE;
-                int item_tile_y = it->world_y / SUBPIXELS_PER_TILE;
-                if (!is_tile_center_inside_player(&player, item_tile_x, item_tile_y))
-                {
-                    continue;
-                }
-
-                it->active = 0;
-                play_sfx_nonblocking(sounds->item_sound_path);
-
-                switch (it->type)
-                {
-                case ITEM_TYPE_SHIELD:
-                    player.shield_count++;
-                    printf("보호막을 획득했습니다! 현재 보호막: %d개\n", player.shield_count);
-                    break;
-                case ITEM_TYPE_SCOOTER:
-                {
-                    const double scooter_multiplier = 2.0;
-                    player.has_scooter = 1;
-                    player.speed_multiplier = scooter_multiplier;
-                    player.move_speed = player.base_move_speed * player.speed_multiplier;
-                    player.scooter_expire_time = elapsed + kScooterDurationSec;
-                    printf("E-scooter 효과 활성화! %.1f초 동안 이동 속도 증가\n", player.speed_multiplier);
-                    break;
-                }
-                case ITEM_TYPE_SUPPLY:
-                    stage.remaining_ammo += SUPPLY_REFILL_AMOUNT;
-                    printf("탄약 보충! 남은 투사체: %d\n", stage.remaining_ammo);
-                    break;
-                default:
-                    break;
-                }
-            }
-            pthread_mutex_unlock(&g_stage_mutex);
-
-            pthread_mutex_lock(&g_stage_mutex);
-            if (player.has_scooter && player.scooter_expire_time > 0.0 && elapsed >= player.scooter_expire_time)
-            {
-                player.has_scooter = 0;
-                player.speed_multiplier = 1.0;
-                player.move_speed = player.base_move_speed * player.speed_multiplier;
-                player.scooter_expire_time = 0.0;
-                printf("E-scooter 효과가 종료되었습니다.\n");
-            }
-            pthread_mutex_unlock(&g_stage_mutex);
-
-            ProfessorBulletResult bullet_result = PROFESSOR_BULLET_RESULT_NONE;
-            pthread_mutex_lock(&g_stage_mutex);
-            move_projectiles(&stage);
-            bullet_result = update_professor_bullets(&stage, &player, frame_delta);
-            pthread_mutex_unlock(&g_stage_mutex);
-
-            if (bullet_result == PROFESSOR_BULLET_RESULT_SHIELD_BLOCKED)
-            {
-                printf("교수의 탄환을 쉴드로 막았습니다! 남은 쉴드: %d개\n", player.shield_count);
-                play_sfx_nonblocking(sounds->item_use_sound_path);
+                stage_cleared = 1;
+                break;
             }
-            else if (bullet_result == PROFESSOR_BULLET_RESULT_FATAL)
+            if (outcome == SIM_OUTCOME_FAILED)
             {
                 stop_bgm();
                 const char *tts_game_out_command = "espeak -a 200 -v en-us+m5 -s 140 'Game Out!'";
@@ -526,22 +573,13 @@ static GameplayOutcome run_campaign(int start_stage_id,
                 break;
             }
 
-            struct timespec frame_end_ts;
-            clock_gettime(CLOCK_MONOTONIC, &frame_end_ts);
-            double frame_time_ms = (frame_end_ts.tv_sec - frame_start_ts.tv_sec) * 1000.0 +
-                                   (frame_end_ts.tv_nsec - frame_start_ts.tv_nsec) / 1000000.0;
-            const double target_frame_time_ms = 16.67;
-            if (frame_time_ms < target_frame_time_ms)
-            {
-                double sleep_time_ms = target_frame_time_ms - frame_time_ms;
-                struct timespec sleep_ts = {
-                    .tv_sec = 0,
-                    .tv_nsec = (long)(sleep_time_ms * 1000000.0)};
-                nanosleep(&sleep_ts, NULL);
-            }
+            // vsync가 동작하면 화면 표시가 기다려 주므로 여기서는 잠들지 않음
+            frame_pacer_end_frame(&g_frame_pacer);
         }
 
         stop_obstacle_thread();
+        unload_stage(&stage);
+        log_flush(); // 스테이지 중 쌓인 메시지를 아래 결과 출력보다 먼저
 
         if (!g_running)
         {
@@ -618,6 +656,72 @@ static GameplayOutcome run_campaign(int start_stage_id,
     return GAMEPLAY_OUTCOME_CLEARED;
 }
 
+// vsync 동작 여부/주사율/FPS 제한에 따라 대기 방식을 하나로 정함
+static void setup_frame_pacer(void)
+{
+    double refresh_hz = render_display_refresh_hz();
+    double effective_refresh_hz = (refresh_hz > 0.0) ? refresh_hz : 60.0;
+    int capped_below_refresh = g_pacer_config.fps_cap > 0.0 && g_pacer_config.fps_cap < effective_refresh_hz * 0.95;
+    if (g_pacer_config.uncapped || capped_below_refresh)
+    {
+        // vsync와 수면을 겹치면 두 번 기다리게 되므로 가능하면 vsync를 끔
+        render_set_vsync(0);
+    }
+    frame_pacer_init(&g_frame_pacer, &g_pacer_config, refresh_hz, render_vsync_active());
+}
+
+static void report_frame_pacing(void)
+{
+    const FramePacerStats *stats = &g_frame_pacer.stats;
+    if (stats->frames == 0)
+    {
+        return;
+    }
+    printf("프레임 페이싱: %s, 목표 %.1fHz (디스플레이 %.0fHz), 평균 간격 %.2fms, 오차 평균 %.2fms / 최대 %.2fms, 긴 프레임 %lu/%lu\n",
+           frame_pacer_mode_name(stats->mode), stats->target_hz, stats->refresh_hz, stats->interval_avg_ms,
+           stats->error_avg_ms, stats->error_max_ms, stats->long_frames, stats->frames);
+}
+
+// F3 오버레이용 지표 수집 (틱 통계는 짧은 뮤텍스 복사, 보이스 수는 공유 페이지 읽기)
+static void publish_perf_stats(double stage_load_ms)
+{
+    ObstacleTickStats tick_stats;
+    get_obstacle_tick_stats(&tick_stats);
+
+    RenderPerfStats perf = {
+        .tick_hz = tick_stats.tick_hz,
+        .tick_measured_hz = tick_stats.measured_hz,
+        .tick_jitter_avg_ms = tick_stats.jitter_avg_ms,
+        .tick_jitter_max_ms = tick_stats.jitter_max_ms,
+        .tick_missed = tick_stats.missed_deadlines,
+        .audio_voices = get_active_sfx_voices(),
+        .stage_load_ms = stage_load_ms,
+        .pace_mode = frame_pacer_mode_name(g_frame_pacer.stats.mode),
+        .pace_target_hz = g_frame_pacer.stats.target_hz,
+        .display_refresh_hz = g_frame_pacer.stats.refresh_hz,
+        .pace_error_avg_ms = g_frame_pacer.stats.error_avg_ms,
+        .pace_error_max_ms = g_frame_pacer.stats.error_max_ms,
+        .pace_long_frames = g_frame_pacer.stats.long_frames,
+    };
+    instrumented_mutex_snapshot(&g_stage_mutex, STAGE_LOCK_SITE_SIM_TICK, &perf.stage_lock);
+
+    WorldStateReadStats read_stats;
+    world_state_get_read_stats(&read_stats);
+    perf.seqlock_reads = read_stats.reads;
+    perf.seqlock_retries = read_stats.retries;
+    perf.seqlock_wait_max_us = read_stats.retry_wait_max_us;
+
+    SimulationQueueStats queue_stats;
+    simulation_get_queue_stats(&queue_stats);
+    perf.queue_commands_dropped = queue_stats.commands_dropped;
+    perf.queue_events_dropped = queue_stats.events_dropped;
+    render_set_perf_stats(&perf);
+
+    // 동적 해상도는 페이서 목표 주기를 예산으로 삼음 (무제한이면 60Hz 기준)
+    double target_hz = g_frame_pacer.stats.target_hz;
+    render_set_frame_budget_ms(1000.0 / (target_hz > 0.0 ? target_hz : 60.0));
+}
+
 static void drain_pending_input(void)
 {
     int flushed = 0;
@@ -630,3 +734,250 @@ static void drain_pending_input(void)
         SDL_Delay(10);
     }
 }
+
+// 시뮬레이션이 보낸 이벤트 → 효과음/메시지 (사운드는 메인 스레드에서만 요청)
+static void handle_sim_event(const SimEvent *ev, const SoundAssets *sounds)
+{
+    switch (ev->type)
+    {
+    case SIM_EVENT_BAG_ACQUIRED:
+        play_sfx_nonblocking(sounds->bag_acquire_sound_path);
+        break;
+    case SIM_EVENT_WALK:
+        play_sfx_nonblocking(sounds->walking_sound_path);
+        break;
+    case SIM_EVENT_FIRE:
+        play_sfx_nonblocking(sounds->item_use_sound_path);
+        break;
+    case SIM_EVENT_FIRE_EMPTY:
+        play_sfx_nonblocking(sounds->no_item_sound_path);
+        break;
+    case SIM_EVENT_ITEM_PICKED:
+        play_sfx_nonblocking(sounds->item_sound_path);
+        switch (ev->item_type)
+        {
+        case ITEM_TYPE_SHIELD:
+            LOG_INFO(LOG_CAT_GAME, "보호막을 획득했습니다! 현재 보호막: %d개", ev->value);
+            break;
+        case ITEM_TYPE_SCOOTER:
+            LOG_INFO(LOG_CAT_GAME, "E-scooter 효과 활성화! %.1f초 동안 이동 속도 증가", ev->value_f);
+            break;
+        case ITEM_TYPE_SUPPLY:
+            LOG_INFO(LOG_CAT_GAME, "탄약 보충! 남은 투사체: %d", ev->value);
+            break;
+        default:
+            break;
+        }
+        break;
+    case SIM_EVENT_SCOOTER_EXPIRED:
+        LOG_INFO(LOG_CAT_GAME, "E-scooter 효과가 종료되었습니다.");
+        break;
+    case SIM_EVENT_SHIELD_BLOCKED:
+        if (ev->source == SIM_HAZARD_TRAP)
+        {
+            LOG_INFO(LOG_CAT_GAME, "쉴드로 방어 했습니다! 남은 쉴드: %d개", ev->value);
+        }
+        else
+        {
+            LOG_INFO(LOG_CAT_GAME, "교수의 탄환을 쉴드로 막았습니다! 남은 쉴드: %d개", ev->value);
+        }
+        play_sfx_nonblocking(sounds->item_use_sound_path);
+        break;
+    case SIM_EVENT_STAGE_FAILED:
+        if (ev->source == SIM_HAZARD_TRAP)
+        {
+            LOG_INFO(LOG_CAT_GAME, "트랩을 밟았습니다!");
+        }
+        break;
+    case SIM_EVENT_STAGE_CLEARED:
+    default:
+        break;
+    }
+}
+
+// 실행 인자 해석
+// - "--옵션=값" 형태는 설정으로, 나머지 첫 인자는 맵 파일 이름으로 사용
+static int parse_command_line(int argc, char *argv[], CommandLineOptions *options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char *arg = argv[i];
+        if (strncmp(arg, "--", 2) != 0)
+        {
+            if (options->map_arg)
+            {
+                fprintf(stderr, "맵 파일은 하나만 지정할 수 있습니다: %s\n", arg);
+                return -1;
+            }
+            options->map_arg = arg;
+            continue;
+        }
+
+        if (strncmp(arg, "--tick-hz=", 10) == 0)
+        {
+            int hz = atoi(arg + 10);
+            if (hz <= 0)
+            {
+                fprintf(stderr, "잘못된 틱 주기: %s\n", arg);
+                return -1;
+            }
+            set_obstacle_tick_rate(hz);
+            continue;
+        }
+
+        if (strncmp(arg, "--seed=", 7) == 0)
+        {
+            char *end = NULL;
+            unsigned long long seed = strtoull(arg + 7, &end, 0);
+            if (end == arg + 7 || *end != '\0')
+            {
+                fprintf(stderr, "잘못된 시드: %s\n", arg);
+                return -1;
+            }
+            set_stage_rng_seed(seed);
+            continue;
+        }
+
+        if (strncmp(arg, "--fps-cap=", 10) == 0)
+        {
+            int cap = atoi(arg + 10);
+            if (cap < 0 || cap > 1000)
+            {
+                fprintf(stderr, "잘못된 FPS 제한(0~1000, 0이면 주사율): %s\n", arg);
+                return -1;
+            }
+            g_pacer_config.fps_cap = (double)cap;
+            continue;
+        }
+
+        if (strcmp(arg, "--uncapped") == 0)
+        {
+            g_pacer_config.uncapped = 1;
+            continue;
+        }
+
+        if (strncmp(arg, "--dynamic-res=", 14) == 0)
+        {
+            const char *value = arg + 14;
+            if (strcmp(value, "0") != 0 && strcmp(value, "1") != 0)
+            {
+                fprintf(stderr, "잘못된 동적 해상도 설정(0 또는 1): %s\n", arg);
+                return -1;
+            }
+            render_set_dynamic_resolution(value[0] == '1');
+            continue;
+        }
+
+        if (strncmp(arg, "--trace=", 8) == 0)
+        {
+            if (arg[8] == '\0')
+            {
+                fprintf(stderr, "트레이스 파일 경로가 비어 있습니다: %s\n", arg);
+                return -1;
+            }
+            options->trace_path = arg + 8;
+            continue;
+        }
+
+        if (strncmp(arg, "--sim-threads=", 14) == 0)
+        {
+            int threads = atoi(arg + 14);
+            if (threads < 0 || threads > JOB_MAX_WORKERS)
+            {
+                fprintf(stderr, "잘못된 시뮬레이션 스레드 수(0~%d): %s\n", JOB_MAX_WORKERS, arg);
+                return -1;
+            }
+            options->sim_threads = threads;
+            continue;
+        }
+
+        if (strcmp(arg, "--bench-obstacles") == 0 || strncmp(arg, "--bench-obstacles=", 18) == 0)
+        {
+            int ticks = (arg[17] == '=') ? atoi(arg + 18) : 600;
+            if (ticks <= 0)
+            {
+                fprintf(stderr, "잘못된 벤치마크 틱 수: %s\n", arg);
+                return -1;
+            }
+            options->bench_obstacle_ticks = ticks;
+            continue;
+        }
+
+        if (strcmp(arg, "--bench-render") == 0 || strncmp(arg, "--bench-render=", 15) == 0)
+        {
+            int frames = (arg[14] == '=') ? atoi(arg + 15) : 600;
+            if (frames <= 0)
+            {
+                fprintf(stderr, "잘못된 렌더 벤치마크 프레임 수: %s\n", arg);
+                return -1;
+            }
+            options->bench_render_frames = frames;
+            continue;
+        }
+
+        if (strncmp(arg, "--capture=", 10) == 0)
+        {
+            if (arg[10] == '\0')
+            {
+                fprintf(stderr, "녹화 파일 경로가 비어 있습니다: %s\n", arg);
+                return -1;
+            }
+            options->capture_path = arg + 10;
+            continue;
+        }
+
+        if (strncmp(arg, "--capture-fps=", 14) == 0)
+        {
+            int fps = atoi(arg + 14);
+            if (fps <= 0 || fps > 120)
+            {
+                fprintf(stderr, "잘못된 녹화 FPS(1~120): %s\n", arg);
+                return -1;
+            }
+            options->capture_fps = fps;
+            continue;
+        }
+
+        if (strncmp(arg, "--render-dump=", 14) == 0)
+        {
+            if (arg[14] == '\0')
+            {
+                fprintf(stderr, "프레임 저장 디렉터리가 비어 있습니다: %s\n", arg);
+                return -1;
+            }
+            options->render_bench.dump_dir = arg + 14;
+            continue;
+        }
+
+        if (strncmp(arg, "--render-dump-every=", 20) == 0)
+        {
+            int every = atoi(arg + 20);
+            if (every <= 0)
+            {
+                fprintf(stderr, "잘못된 프레임 저장 간격: %s\n", arg);
+                return -1;
+            }
+            options->render_bench.sample_every = every;
+            continue;
+        }
+
+        if (strncmp(arg, "--render-dump-format=", 21) == 0)
+        {
+            const char *value = arg + 21;
+            if (strcmp(value, "png") == 0)
+                options->render_bench.dump_format = RENDER_DUMP_PNG;
+            else if (strcmp(value, "raw") == 0)
+                options->render_bench.dump_format = RENDER_DUMP_RAW;
+            else
+            {
+                fprintf(stderr, "잘못된 프레임 저장 형식(png 또는 raw): %s\n", arg);
+                return -1;
+            }
+            continue;
+        }
+
+        fprintf(stderr, "알 수 없는 옵션: %s\n", arg);
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include <stdlib.h>
+
+#include "../include/move_field.h"
+#include "../include/collision.h"
+
+struct MoveField
+{
+    int width;
+    int height;
+    unsigned char *open_bits; // [height][width] 비트, 타일 (x, y)는 y * width + x번째 비트
+};
+
+static inline void set_open(struct MoveField *field, int x, int y, int open)
+{
+    const size_t bit = (size_t)y * field->width + x;
+    const unsigned char mask = (unsigned char)(1u << (bit & 7u));
+    if (open)
+        field->open_bits[bit >> 3] |= mask;
+    else
+        field->open_bits[bit >> 3] &= (unsigned char)~mask;
+}
+
+static int is_tile_open(const Stage *stage, int x, int y)
+{
+    if (is_tile_impassable_char(stage->map[y][x]))
+        return 0;
+    return !is_active_breakable_wall_at(stage, x, y);
+}
+
+struct MoveField *move_field_build(const Stage *stage)
+{
+    if (!stage)
+        return NULL;
+
+    int width = (stage->width > 0) ? stage->width : MAX_X;
+    int height = (stage->height > 0) ? stage->height : MAX_Y;
+
+    struct MoveField *field = calloc(1, sizeof(*field));
+    if (field)
+        field->open_bits = calloc(((size_t)width * height + 7u) / 8u, 1);
+    if (!field || !field->open_bits)
+    {
+        move_field_destroy(field);
+        return NULL;
+    }
+    field->width = width;
+    field->height = height;
+
+    // 맵 문자로 먼저 채우고 깨지는 벽 칸만 덮어씀 (타일마다 장애물을 훑지 않음)
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+            set_open(field, x, y, !is_tile_impassable_char(stage->map[y][x]));
+    }
+    for (int i = 0; i < stage->num_obstacles; ++i)
+    {
+        const Obstacle *o = &stage->obstacles[i];
+        if (!o->active || o->kind != OBSTACLE_KIND_BREAKABLE_WALL)
+            continue;
+        int tx = o->world_x / SUBPIXELS_PER_TILE;
+        int ty = o->world_y / SUBPIXELS_PER_TILE;
+        if (tx >= 0 && ty >= 0 && tx < width && ty < height)
+            set_open(field, tx, ty, 0);
+    }
+    return field;
+}
+
+void move_field_destroy(struct MoveField *field)
+{
+    if (!field)
+        return;
+    free(field->open_bits);
+    free(field);
+}
+
+int move_field_is_open(const struct MoveField *field, int tile_x, int tile_y)
+{
+    if (tile_x < 0 || tile_y < 0 || tile_x >= field->width || tile_y >= field->height)
+        return 0;
+    const size_t bit = (size_t)tile_y * field->width + tile_x;
+    return (field->open_bits[bit >> 3] >> (bit & 7u)) & 1u;
+}
+
+void move_field_update_tile(struct MoveField *field, const Stage *stage, int tile_x, int tile_y)
+{
+    if (!field || !stage)
+        return;
+    if (tile_x < 0 || tile_y < 0 || tile_x >= field->width || tile_y >= field->height)
+        return;
+
+    set_open(field, tile_x, tile_y, is_tile_open(stage, tile_x, tile_y));
+}
@@ -1,16 +1,26 @@
 #define _POSIX_C_SOURCE 199309L
 #define _DEFAULT_SOURCE
+#include <errno.h>
 #include <pthread.h>
 #include <unistd.h>
 #include <math.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "../include/obstacle.h"
 #include "../include/game.h"
 #include "../include/signal_handler.h"
 #include "../include/collision.h"
 #include "../include/professor_pattern.h"
+#include "../include/hazard.h"
+#include "../include/job_system.h"
+#include "../include/log.h"
+#include "../include/pvs.h"
+#include "../include/simulation.h"
+#include "../include/trace.h"
+#include "../include/world_state.h"
 
 typedef struct
 {
@@ -18,8 +28,38 @@ typedef struct
     int first_dir; // 출발지에서 처음 움직였던 방향 (1:우, 2:좌, 3:하, 4:상)
 } Node;
 #define QUEUE_SIZE (MAX_X * MAX_Y)
+#define OBSTACLE_JOB_GRAIN 2 // 잡 하나가 맡는 최대 장애물 수 (교수 BFS가 무거워 작게)
 
-pthread_mutex_t g_stage_mutex = PTHREAD_MUTEX_INITIALIZER;
+// BFS 작업 공간 (잡 워커마다 하나씩, 병렬 이동 단계에서 공유하지 않도록)
+typedef struct
+{
+    char visited[MAX_Y][MAX_X];
+    Node queue[QUEUE_SIZE];
+} BfsScratch;
+
+static BfsScratch g_bfs_scratch[JOB_MAX_WORKERS];
+
+// 이동 단계 입력/결과
+// - should_move: 직렬 패턴 단계에서 정한 교수 이동 여부
+// - intents: 병렬로 계산한 각 장애물의 다음 상태 (인덱스 순서대로 반영)
+typedef struct
+{
+    Stage *stage;
+    double delta_time;
+    unsigned char should_move[MAX_OBSTACLES];
+    Obstacle intents[MAX_OBSTACLES];
+} ObstacleMoveJob;
+
+static ObstacleMoveJob g_move_job;
+
+InstrumentedMutex g_stage_mutex = {
+    .mutex = PTHREAD_MUTEX_INITIALIZER,
+    .name = "g_stage_mutex",
+    .sites = {
+        [STAGE_LOCK_SITE_TICK_START] = {.name = "obstacle thread: tick start"},
+        [STAGE_LOCK_SITE_SIM_TICK] = {.name = "obstacle thread: sim tick"},
+    },
+};
 
 // 장애물 스레드에서 접근할 현재 스테이지 포인터.
 static Stage *g_stage = NULL;
@@ -33,6 +73,14 @@ static int g_thread_running = 0;
 // 장애물 스레드가 플레이어 위치를 참고하기 위한 포인터
 static Player *g_player_ref = NULL;
 
+// 고정 주기 틱 설정/통계
+// - 절대 마감 시각(CLOCK_MONOTONIC) 기준으로 깨어나서 부하와 무관하게 틱 간격 유지
+// - 늦으면 최대 OBSTACLE_MAX_CATCHUP_STEPS 번까지 고정 dt로 따라잡고 나머지는 버림
+static int g_tick_hz = OBSTACLE_TICK_HZ_DEFAULT;
+static ObstacleTickStats g_tick_stats;
+static double g_tick_jitter_sum_ms = 0.0;
+static pthread_mutex_t g_tick_stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+
 // 메인에서 플레이어 주소를 넘겨받는 함수 (obstacle.h에도 선언 필요)
 void set_obstacle_player_ref(Player *p)
 {
@@ -62,16 +110,16 @@ static void update_spinner(Obstacle *o, Stage *stage)
 }
 
 // Bfs 로 교수님 로직 변경
-static int get_next_step_bfs(Stage *stage, int start_tx, int start_ty, int target_tx, int target_ty)
+static int get_next_step_bfs(const Stage *stage, BfsScratch *scratch, int start_tx, int start_ty, int target_tx, int target_ty)
 {
     // 이미 목표에 도착했으면 정지
     if (start_tx == target_tx && start_ty == target_ty)
         return 0;
 
-    static char visited[MAX_Y][MAX_X];
-    memset(visited, 0, sizeof(visited));
+    char (*visited)[MAX_X] = scratch->visited;
+    memset(scratch->visited, 0, sizeof(scratch->visited));
 
-    static Node queue[QUEUE_SIZE];
+    Node *queue = scratch->queue;
     int front = 0;
     int rear = 0;
 
@@ -117,255 +165,451 @@ static int get_next_step_bfs(Stage *stage, int start_tx, int start_ty, int targe
     return 0;
 }
 
-//  교수님 AI (추격) 로직
-static void update_professor(Obstacle *o, Stage *stage, double delta_time)
+//  교수님 발견 판정 + 패턴 (직렬 단계: 패턴은 분신/탄환/플레이어까지 바꿀 수 있음)
+// 패턴 함수가 0을 반환하면(스킬 시전 등) 이번 틱 이동을 건너뜀
+static int update_professor_pattern_phase(Obstacle *o, Stage *stage, double delta_time)
 {
     if (!g_player_ref)
-        return;
+        return 0;
 
     if (o->alert == 0)
     {
         int dx = g_player_ref->world_x - o->world_x;
         int dy = g_player_ref->world_y - o->world_y;
         double dist = (fabs((double)dx) + fabs((double)dy)) / (double)SUBPIXELS_PER_TILE;
-        if (dist <= o->sight_range)
-            o->alert = 1;
+        if (dist <= o->sight_range &&
+            pvs_can_see(stage->pvs,
+                        (o->world_x + SUBPIXELS_PER_TILE / 2) / SUBPIXELS_PER_TILE,
+                        (o->world_y + SUBPIXELS_PER_TILE / 2) / SUBPIXELS_PER_TILE,
+                        (g_player_ref->world_x + SUBPIXELS_PER_TILE / 2) / SUBPIXELS_PER_TILE,
+                        (g_player_ref->world_y + SUBPIXELS_PER_TILE / 2) / SUBPIXELS_PER_TILE))
+            o->alert = 1; // 시야 거리 안 + 벽에 가리지 않음
     }
-    // 패턴 함수 호출
-    // 패턴 함수가 0을 반환하면(스킬 시전 등) should_move가 0이 되어 이동을 건너뛰게 됨.
-    int should_move = update_professor_pattern(stage, o, g_player_ref, delta_time);
+    return update_professor_pattern(stage, o, g_player_ref, delta_time);
+}
 
-    if (should_move) // 패턴 함수가 1을 반환해야 이동 가능
-    {
-        if (delta_time < 0.0)
-            delta_time = 0.0;
-        o->move_accumulator += o->move_speed * delta_time;
-        int pixels_to_move = (int)floor(o->move_accumulator);
+//  교수님 AI (추격) 이동 (병렬 단계: 자기 자신만 바꾸고 맵/플레이어는 읽기만)
+static void update_professor(Obstacle *o, Stage *stage, double delta_time, BfsScratch *scratch)
+{
+    if (!g_player_ref)
+        return;
 
-        if (pixels_to_move <= 0)
-            return;
-        if (pixels_to_move > SUBPIXELS_PER_TILE)
-            pixels_to_move = SUBPIXELS_PER_TILE;
-        o->move_accumulator -= pixels_to_move;
+    if (delta_time < 0.0)
+        delta_time = 0.0;
+    o->move_accumulator += o->move_speed * delta_time;
+    int pixels_to_move = (int)floor(o->move_accumulator);
+
+    if (pixels_to_move <= 0)
+        return;
+    if (pixels_to_move > SUBPIXELS_PER_TILE)
+        pixels_to_move = SUBPIXELS_PER_TILE;
+    o->move_accumulator -= pixels_to_move;
 
-        const int TILE = SUBPIXELS_PER_TILE;
+    const int TILE = SUBPIXELS_PER_TILE;
 
-        for (int step = 0; step < pixels_to_move; ++step)
+    for (int step = 0; step < pixels_to_move; ++step)
+    {
+        if (o->alert)
         {
-            if (o->alert)
-            {
 
-                int center_x = o->world_x + TILE / 2;
-                int center_y = o->world_y + TILE / 2;
+            int center_x = o->world_x + TILE / 2;
+            int center_y = o->world_y + TILE / 2;
 
-                int cur_tx = center_x / TILE;
-                int cur_ty = center_y / TILE;
+            int cur_tx = center_x / TILE;
+            int cur_ty = center_y / TILE;
 
-                int target_tx = (g_player_ref->world_x + TILE / 2) / TILE;
-                int target_ty = (g_player_ref->world_y + TILE / 2) / TILE;
+            int target_tx = (g_player_ref->world_x + TILE / 2) / TILE;
+            int target_ty = (g_player_ref->world_y + TILE / 2) / TILE;
 
-                int next_dir = get_next_step_bfs(stage, cur_tx, cur_ty, target_tx, target_ty);
+            int next_dir = get_next_step_bfs(stage, scratch, cur_tx, cur_ty, target_tx, target_ty);
 
-                int dx = 0;
-                int dy = 0;
+            int dx = 0;
+            int dy = 0;
 
-                int tile_center_world_x = cur_tx * TILE;
-                int tile_center_world_y = cur_ty * TILE;
+            int tile_center_world_x = cur_tx * TILE;
+            int tile_center_world_y = cur_ty * TILE;
 
-                int align_power = 1;
+            int align_power = 1;
 
-                if (next_dir == 1)
-                {
-                    dx = 1;
+            if (next_dir == 1)
+            {
+                dx = 1;
+
+                if (o->world_y > tile_center_world_y)
+                    dy = -align_power;
+                else if (o->world_y < tile_center_world_y)
+                    dy = align_power;
+            }
+            else if (next_dir == 2)
+            {
+                dx = -1;
+
+                if (o->world_y > tile_center_world_y)
+                    dy = -align_power;
+                else if (o->world_y < tile_center_world_y)
+                    dy = align_power;
+            }
+            else if (next_dir == 3)
+            {
+                dy = 1;
 
-                    if (o->world_y > tile_center_world_y)
-                        dy = -align_power;
-                    else if (o->world_y < tile_center_world_y)
-                        dy = align_power;
+                if (o->world_x > tile_center_world_x)
+                    dx = -align_power;
+                else if (o->world_x < tile_center_world_x)
+                    dx = align_power;
+            }
+            else if (next_dir == 4)
+            {
+                dy = -1;
+
+                if (o->world_x > tile_center_world_x)
+                    dx = -align_power;
+                else if (o->world_x < tile_center_world_x)
+                    dx = align_power;
+            }
+
+            if (dx != 0 || dy != 0)
+            {
+
+                if (try_move_obstacle(o, stage, dx, dy))
+                {
                 }
-                else if (next_dir == 2)
+
+                else
                 {
-                    dx = -1;
+                    int main_dx = (next_dir == 1) ? 1 : ((next_dir == 2) ? -1 : 0);
+                    int main_dy = (next_dir == 3) ? 1 : ((next_dir == 4) ? -1 : 0);
+
+                    if (!try_move_obstacle(o, stage, main_dx, main_dy))
+                    {
 
-                    if (o->world_y > tile_center_world_y)
-                        dy = -align_power;
-                    else if (o->world_y < tile_center_world_y)
-                        dy = align_power;
+                        int align_dx = dx - main_dx;
+                        int align_dy = dy - main_dy;
+                        try_move_obstacle(o, stage, align_dx, align_dy);
+                    }
                 }
-                else if (next_dir == 3)
-                {
-                    dy = 1;
+            }
+        }
+        else
+        {
 
-                    if (o->world_x > tile_center_world_x)
-                        dx = -align_power;
-                    else if (o->world_x < tile_center_world_x)
-                        dx = align_power;
+            int dir = (o->dir == 0) ? 1 : o->dir;
+            if (o->type == 0)
+            {
+                if (!try_move_obstacle(o, stage, dir, 0))
+                {
+                    o->dir = -dir;
+                    try_move_obstacle(o, stage, o->dir, 0);
                 }
-                else if (next_dir == 4)
+            }
+            else
+            {
+                if (!try_move_obstacle(o, stage, 0, dir))
                 {
-                    dy = -1;
-
-                    if (o->world_x > tile_center_world_x)
-                        dx = -align_power;
-                    else if (o->world_x < tile_center_world_x)
-                        dx = align_power;
+                    o->dir = -dir;
+                    try_move_obstacle(o, stage, 0, o->dir);
                 }
+            }
+        }
+    }
+}
 
-                if (dx != 0 || dy != 0)
-                {
+// 장애물 하나의 다음 상태 계산 (o는 intents 쪽 사본)
+// - 장애물끼리는 서로 막지 않고, 막힘 판정은 맵과 깨지는 벽(이동 단계 동안 불변)만 보므로 순서와 무관
+static void update_obstacle(Obstacle *o, Stage *stage, double delta_time, int should_move, BfsScratch *scratch)
+{
+    switch (o->kind)
+    {
+    case OBSTACLE_KIND_SPINNER:
+        update_spinner(o, stage);
+        break;
 
-                    if (try_move_obstacle(o, stage, dx, dy))
-                    {
-                    }
+    case OBSTACLE_KIND_PROFESSOR:
+        if (should_move)
+            update_professor(o, stage, delta_time, scratch);
+        break;
 
-                    else
-                    {
-                        int main_dx = (next_dir == 1) ? 1 : ((next_dir == 2) ? -1 : 0);
-                        int main_dy = (next_dir == 3) ? 1 : ((next_dir == 4) ? -1 : 0);
+    case OBSTACLE_KIND_BREAKABLE_WALL:
+        break;
 
-                        if (!try_move_obstacle(o, stage, main_dx, main_dy))
-                        {
+    case OBSTACLE_KIND_LINEAR:
+    default:
+        o->move_accumulator += o->move_speed * delta_time;
+        int step_pixels = (int)floor(o->move_accumulator);
+        if (step_pixels <= 0)
+            break;
 
-                            int align_dx = dx - main_dx;
-                            int align_dy = dy - main_dy;
-                            try_move_obstacle(o, stage, align_dx, align_dy);
-                        }
-                    }
-                }
+        o->move_accumulator -= step_pixels;
+        int total_moved = 0;
+        const int max_step = SUBPIXELS_PER_TILE;
+
+        while (total_moved < step_pixels)
+        {
+            int move = o->dir;
+            if (move == 0)
+                move = 1;
+            move *= 1;
+
+            int applied = 0;
+            if (o->type == 0)
+            {
+                applied = try_move_obstacle(o, stage, move, 0);
             }
             else
             {
+                applied = try_move_obstacle(o, stage, 0, move);
+            }
 
-                int dir = (o->dir == 0) ? 1 : o->dir;
+            if (!applied)
+            {
+                o->dir *= -1;
                 if (o->type == 0)
                 {
-                    if (!try_move_obstacle(o, stage, dir, 0))
+                    if (!try_move_obstacle(o, stage, o->dir, 0))
                     {
-                        o->dir = -dir;
-                        try_move_obstacle(o, stage, o->dir, 0);
+                        break;
                     }
                 }
                 else
                 {
-                    if (!try_move_obstacle(o, stage, 0, dir))
+                    if (!try_move_obstacle(o, stage, 0, o->dir))
                     {
-                        o->dir = -dir;
-                        try_move_obstacle(o, stage, 0, o->dir);
+                        break;
                     }
                 }
             }
+
+            total_moved += (applied ? 1 : 0);
+            if (total_moved >= max_step)
+                break;
         }
+        break;
+    }
+}
+
+// 트레이스 구간 이름 (종류별로 타임라인에서 구분)
+static const char *obstacle_trace_name(ObstacleKind kind)
+{
+    switch (kind)
+    {
+    case OBSTACLE_KIND_LINEAR:
+        return "obstacle linear";
+    case OBSTACLE_KIND_SPINNER:
+        return "obstacle spinner";
+    case OBSTACLE_KIND_PROFESSOR:
+        return "obstacle professor";
+    case OBSTACLE_KIND_BREAKABLE_WALL:
+        return "obstacle breakable wall";
+    default:
+        return "obstacle other";
+    }
+}
+
+static void move_obstacle_range(void *ctx, int begin, int end, int worker)
+{
+    ObstacleMoveJob *job = (ObstacleMoveJob *)ctx;
+    BfsScratch *scratch = &g_bfs_scratch[worker];
+
+    for (int i = begin; i < end; ++i)
+    {
+        Obstacle *next = &job->intents[i];
+        *next = job->stage->obstacles[i];
+        if (!next->active)
+            continue;
+        uint64_t trace_obstacle = trace_begin();
+        update_obstacle(next, job->stage, job->delta_time, job->should_move[i], scratch);
+        trace_end(obstacle_trace_name(next->kind), "obstacle", trace_obstacle);
     }
 }
 
 // 스테이지 내의 모든 장애물을 한 번씩 이동시키는 함수.
+// 1) 교수 패턴은 스테이지/플레이어를 바꾸므로 직렬로 먼저 실행
+// 2) 장애물별 다음 상태를 잡 시스템으로 병렬 계산
+// 3) 인덱스 순서대로 반영 (스레드 수와 무관하게 같은 결과)
 void move_obstacles(Stage *stage, double delta_time)
 {
     if (delta_time < 0.0)
         delta_time = 0.0;
 
+    ObstacleMoveJob *job = &g_move_job;
+    job->stage = stage;
+    job->delta_time = delta_time;
+
+    uint64_t trace_patterns = trace_begin();
     for (int i = 0; i < stage->num_obstacles; i++)
     {
         Obstacle *o = &stage->obstacles[i];
-        if (!o->active)
-            continue;
+        job->should_move[i] = 1;
+        if (o->active && o->kind == OBSTACLE_KIND_PROFESSOR)
+            job->should_move[i] = (unsigned char)update_professor_pattern_phase(o, stage, delta_time);
+    }
+    trace_end("professor patterns", "obstacle", trace_patterns);
 
-        switch (o->kind)
-        {
-        case OBSTACLE_KIND_SPINNER:
-            update_spinner(o, stage);
-            break;
+    uint64_t trace_move = trace_begin();
+    job_system_parallel_for(stage->num_obstacles, OBSTACLE_JOB_GRAIN, move_obstacle_range, job);
+    trace_end("move_obstacles", "obstacle", trace_move);
 
-        case OBSTACLE_KIND_PROFESSOR:
-            update_professor(o, stage, delta_time);
-            break;
+    for (int i = 0; i < stage->num_obstacles; i++)
+    {
+        if (stage->obstacles[i].active)
+            stage->obstacles[i] = job->intents[i];
+    }
 
-        case OBSTACLE_KIND_BREAKABLE_WALL:
-            break;
+    // 패턴 단계의 순간이동/비활성화까지 포함해 충돌 판정용 SoA 갱신
+    hazard_sync_obstacles(stage);
+}
 
-        case OBSTACLE_KIND_LINEAR:
-        default:
-            o->move_accumulator += o->move_speed * delta_time;
-            int step_pixels = (int)floor(o->move_accumulator);
-            if (step_pixels <= 0)
-                break;
+void set_obstacle_tick_rate(int hz)
+{
+    if (hz < OBSTACLE_TICK_HZ_MIN)
+        hz = OBSTACLE_TICK_HZ_MIN;
+    if (hz > OBSTACLE_TICK_HZ_MAX)
+        hz = OBSTACLE_TICK_HZ_MAX;
+    g_tick_hz = hz;
+}
 
-            o->move_accumulator -= step_pixels;
-            int total_moved = 0;
-            const int max_step = SUBPIXELS_PER_TILE;
+int get_obstacle_tick_rate(void)
+{
+    return g_tick_hz;
+}
 
-            while (total_moved < step_pixels)
-            {
-                int move = o->dir;
-                if (move == 0)
-                    move = 1;
-                move *= 1;
+void get_obstacle_tick_stats(ObstacleTickStats *out)
+{
+    if (!out)
+        return;
 
-                int applied = 0;
-                if (o->type == 0)
-                {
-                    applied = try_move_obstacle(o, stage, move, 0);
-                }
-                else
-                {
-                    applied = try_move_obstacle(o, stage, 0, move);
-                }
+    pthread_mutex_lock(&g_tick_stats_mutex);
+    *out = g_tick_stats;
+    pthread_mutex_unlock(&g_tick_stats_mutex);
+}
 
-                if (!applied)
-                {
-                    o->dir *= -1;
-                    if (o->type == 0)
-                    {
-                        if (!try_move_obstacle(o, stage, o->dir, 0))
-                        {
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        if (!try_move_obstacle(o, stage, 0, o->dir))
-                        {
-                            break;
-                        }
-                    }
-                }
+static long long timespec_diff_ns(const struct timespec *later, const struct timespec *earlier)
+{
+    return (long long)(later->tv_sec - earlier->tv_sec) * 1000000000LL +
+           (later->tv_nsec - earlier->tv_nsec);
+}
 
-                total_moved += (applied ? 1 : 0);
-                if (total_moved >= max_step)
-                    break;
-            }
-            break;
-        }
+static long long timespec_to_ns(const struct timespec *ts)
+{
+    return (long long)ts->tv_sec * 1000000000LL + ts->tv_nsec;
+}
+
+static void timespec_add_ns(struct timespec *ts, long long ns)
+{
+    ts->tv_sec += (time_t)(ns / 1000000000LL);
+    ts->tv_nsec += (long)(ns % 1000000000LL);
+    if (ts->tv_nsec >= 1000000000L)
+    {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000L;
     }
 }
 
-// 실제로 장애물을 주기적으로 움직이는 스레드 함수.
+static void reset_tick_stats(int hz)
+{
+    pthread_mutex_lock(&g_tick_stats_mutex);
+    memset(&g_tick_stats, 0, sizeof(g_tick_stats));
+    g_tick_stats.tick_hz = hz;
+    g_tick_jitter_sum_ms = 0.0;
+    pthread_mutex_unlock(&g_tick_stats_mutex);
+}
+
+// 한 번 깨어날 때마다 통계 갱신 (late_ns: 마감 시각 대비 늦게 깨어난 시간)
+static void record_tick_wakeup(long long late_ns, int due, int steps, double run_sec)
+{
+    double late_ms = late_ns / 1e6;
+
+    pthread_mutex_lock(&g_tick_stats_mutex);
+    g_tick_stats.wakeups++;
+    g_tick_stats.ticks += (unsigned long)steps;
+    if (due > 1)
+        g_tick_stats.missed_deadlines += (unsigned long)(due - 1);
+    if (due > steps)
+        g_tick_stats.dropped_ticks += (unsigned long)(due - steps);
+
+    g_tick_jitter_sum_ms += late_ms;
+    g_tick_stats.jitter_avg_ms = g_tick_jitter_sum_ms / (double)g_tick_stats.wakeups;
+    if (late_ms > g_tick_stats.jitter_max_ms)
+        g_tick_stats.jitter_max_ms = late_ms;
+    if (run_sec > 0.0)
+        g_tick_stats.measured_hz = g_tick_stats.ticks / run_sec;
+    pthread_mutex_unlock(&g_tick_stats_mutex);
+
+    if (due > steps)
+        LOG_WARN(LOG_CAT_SIM, "시뮬레이션이 %.1fms 밀려 틱 %d개를 버렸습니다.", late_ms, due - steps);
+}
+
+// 실제로 장애물(과 플레이어를 포함한 시뮬레이션 전체)을 주기적으로 움직이는 스레드 함수.
+// - usleep 대신 다음 틱의 절대 시각까지 clock_nanosleep(TIMER_ABSTIME)
+// - 락 대기/업데이트 시간이 길어져도 틱 간격이 밀리지 않음
 static void *obstacle_thread_func(void *arg)
 {
     (void)arg;
 
-    struct timespec prev_ts;
-    clock_gettime(CLOCK_MONOTONIC, &prev_ts);
+    const int hz = g_tick_hz;
+    const long long period_ns = 1000000000LL / hz;
+    const double step_dt = 1.0 / (double)hz;
+    reset_tick_stats(hz);
+    trace_thread_name("obstacle tick");
+
+    struct timespec start_ts;
+    clock_gettime(CLOCK_MONOTONIC, &start_ts);
+    struct timespec deadline = start_ts;
+
+    instrumented_lock(&g_stage_mutex, STAGE_LOCK_SITE_TICK_START);
+    world_state_set_tick_timing(timespec_to_ns(&start_ts), period_ns);
+    instrumented_unlock(&g_stage_mutex);
 
     while (g_running && g_thread_running)
     {
+        timespec_add_ns(&deadline, period_ns);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+        {
+            if (!g_running || !g_thread_running)
+                break;
+        }
+
         struct timespec now_ts;
         clock_gettime(CLOCK_MONOTONIC, &now_ts);
-        double delta_time = (now_ts.tv_sec - prev_ts.tv_sec) +
-                            (now_ts.tv_nsec - prev_ts.tv_nsec) / 1e9;
-        prev_ts = now_ts;
+        long long late_ns = timespec_diff_ns(&now_ts, &deadline);
+        if (late_ns < 0)
+            late_ns = 0;
 
-        pthread_mutex_lock(&g_stage_mutex);
+        // 이번에 처리해야 하는 틱 수(지나간 마감 포함)
+        int due = 1 + (int)(late_ns / period_ns);
+        int steps = (due > OBSTACLE_MAX_CATCHUP_STEPS) ? OBSTACLE_MAX_CATCHUP_STEPS : due;
+
+        if (due > steps)
+        {
+            // 따라잡기 한도 초과: 밀린 틱은 버리고 현재 시각 기준으로 다시 맞춤
+            deadline = now_ts;
+        }
+        else
+        {
+            timespec_add_ns(&deadline, period_ns * (due - 1));
+        }
+
+        instrumented_lock(&g_stage_mutex, STAGE_LOCK_SITE_SIM_TICK);
 
         if (g_stage)
         {
+            for (int i = 0; i < steps; ++i)
+            {
+                uint64_t trace_step = trace_begin();
+                simulation_step(g_stage, g_player_ref, step_dt);
+                trace_end("sim tick", "sim", trace_step);
+            }
 
-            move_obstacles(g_stage, delta_time);
+            // 메인 스레드(렌더)는 락 없이 이 스냅샷을 읽어 감
+            uint64_t trace_publish = trace_begin();
+            world_state_set_tick_timing(timespec_to_ns(&deadline), period_ns);
+            world_state_publish(g_stage, g_player_ref);
+            trace_end("world_state publish", "sim", trace_publish);
         }
 
-        pthread_mutex_unlock(&g_stage_mutex);
+        instrumented_unlock(&g_stage_mutex);
 
-        usleep(20000);
+        record_tick_wakeup(late_ns, due, steps, timespec_diff_ns(&now_ts, &start_ts) / 1e9);
     }
 
     return NULL;
@@ -429,6 +673,28 @@ void stop_obstacle_thread(void)
     pthread_join(g_thread, NULL);
 
     g_stage = NULL;
+
+    ObstacleTickStats stats;
+    get_obstacle_tick_stats(&stats);
+    printf("장애물 틱: %dHz 설정, 실측 %.1fHz, 마감 초과 %lu회, 버린 틱 %lu, 지터 평균 %.2fms / 최대 %.2fms\n",
+           stats.tick_hz, stats.measured_hz, stats.missed_deadlines, stats.dropped_ticks,
+           stats.jitter_avg_ms, stats.jitter_max_ms);
+}
+
+void report_stage_lock_stats(void)
+{
+    instrumented_mutex_report(&g_stage_mutex, stdout);
+
+    // 메인 스레드는 이 락 대신 아래 두 곳에서 시뮬레이션과 만남
+    WorldStateReadStats reads;
+    world_state_get_read_stats(&reads);
+    printf("world_state seqlock: 읽기 %lu회, 다시 읽은 읽기 %lu회 (재시도 %lu회, 최대 %.1fus)\n",
+           reads.reads, reads.retried_reads, reads.retries, reads.retry_wait_max_us);
+
+    SimulationQueueStats queues;
+    simulation_get_queue_stats(&queues);
+    printf("시뮬레이션 큐: 명령 %lu개, 가득 차서 못 넣은 명령 %lu개, 버린 이벤트 %lu개\n",
+           queues.commands_pushed, queues.commands_dropped, queues.events_dropped);
 }
 
 static int try_move_obstacle(Obstacle *o, Stage *stage, int delta_world_x, int delta_world_y)
@@ -0,0 +1,207 @@
+// RGBA 픽셀 디스크 캐시
+// - 파일 = 헤더 + 빈틈 없이 채운 RGBA32 픽셀 (pitch = w * 4)
+// - 쓰기는 임시 파일에 쓴 뒤 rename으로 바꿔치기하므로 읽는 쪽이 반쯤 쓴 파일을 보지 않음
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../include/pixel_cache.h"
+
+#define PIXEL_CACHE_MAGIC "PXC1"
+#define PIXEL_CACHE_VERSION 1u
+
+typedef struct
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    uint32_t pitch;
+    uint32_t reserved;
+    int64_t src_mtime_sec; // 원본 PNG 수정 시각/크기 (하나라도 다르면 무효)
+    int64_t src_mtime_nsec;
+    int64_t src_size;
+} PixelCacheHeader;
+
+static atomic_int g_hits = 0;
+static atomic_int g_misses = 0;
+
+static int pixel_cache_enabled(void)
+{
+    const char *env = getenv("GAME_ASSET_CACHE");
+    return !(env && strcmp(env, "0") == 0);
+}
+
+// 원본 경로(realpath)의 FNV-1a 해시로 캐시 파일 이름 생성
+static int cache_file_path(const char *path, char out[PATH_MAX])
+{
+    char canonical[PATH_MAX];
+    if (!realpath(path, canonical))
+    {
+        return -1;
+    }
+
+    uint64_t hash = 1469598103934665603ULL;
+    for (const unsigned char *p = (const unsigned char *)canonical; *p; ++p)
+    {
+        hash ^= *p;
+        hash *= 1099511628211ULL;
+    }
+    int n = snprintf(out, PATH_MAX, "%s/%016llx.rgba", PIXEL_CACHE_DIR, (unsigned long long)hash);
+    return (n > 0 && n < PATH_MAX) ? 0 : -1;
+}
+
+static void fill_source_stamp(PixelCacheHeader *header, const struct stat *src)
+{
+    header->src_mtime_sec = (int64_t)src->st_mtim.tv_sec;
+    header->src_mtime_nsec = (int64_t)src->st_mtim.tv_nsec;
+    header->src_size = (int64_t)src->st_size;
+}
+
+int pixel_cache_load(const char *path, AssetImage *out)
+{
+    if (!out || !pixel_cache_enabled())
+    {
+        return 0;
+    }
+
+    char cache_path[PATH_MAX];
+    struct stat src;
+    if (stat(path, &src) != 0 || cache_file_path(path, cache_path) != 0)
+    {
+        return 0;
+    }
+
+    int fd = open(cache_path, O_RDONLY);
+    if (fd < 0)
+    {
+        atomic_fetch_add(&g_misses, 1);
+        return 0;
+    }
+
+    struct stat cached;
+    void *mapping = MAP_FAILED;
+    if (fstat(fd, &cached) == 0 && (size_t)cached.st_size > sizeof(PixelCacheHeader))
+    {
+        mapping = mmap(NULL, (size_t)cached.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        atomic_fetch_add(&g_misses, 1);
+        return 0;
+    }
+
+    const PixelCacheHeader *header = (const PixelCacheHeader *)mapping;
+    PixelCacheHeader expected;
+    fill_source_stamp(&expected, &src);
+    size_t pixel_bytes = (size_t)header->pitch * header->height;
+    int valid = memcmp(header->magic, PIXEL_CACHE_MAGIC, 4) == 0 &&
+                header->version == PIXEL_CACHE_VERSION &&
+                header->width > 0 && header->height > 0 &&
+                header->pitch == header->width * 4u &&
+                header->src_mtime_sec == expected.src_mtime_sec &&
+                header->src_mtime_nsec == expected.src_mtime_nsec &&
+                header->src_size == expected.src_size &&
+                (size_t)cached.st_size == sizeof(PixelCacheHeader) + pixel_bytes;
+    if (!valid)
+    {
+        munmap(mapping, (size_t)cached.st_size);
+        atomic_fetch_add(&g_misses, 1);
+        return 0;
+    }
+
+    memset(out, 0, sizeof(*out));
+    out->pixels = (const unsigned char *)mapping + sizeof(PixelCacheHeader);
+    out->w = (int)header->width;
+    out->h = (int)header->height;
+    out->pitch = (int)header->pitch;
+    out->mapping = mapping;
+    out->mapping_size = (size_t)cached.st_size;
+    atomic_fetch_add(&g_hits, 1);
+    return 1;
+}
+
+static int write_all(int fd, const void *data, size_t size)
+{
+    const unsigned char *p = (const unsigned char *)data;
+    while (size > 0)
+    {
+        ssize_t written = write(fd, p, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        p += written;
+        size -= (size_t)written;
+    }
+    return 0;
+}
+
+void pixel_cache_store(const char *path, const AssetImage *image)
+{
+    if (!image || !image->pixels || !pixel_cache_enabled())
+    {
+        return;
+    }
+
+    char cache_path[PATH_MAX];
+    struct stat src;
+    if (stat(path, &src) != 0 || cache_file_path(path, cache_path) != 0)
+    {
+        return;
+    }
+    if (mkdir(PIXEL_CACHE_DIR, 0755) != 0 && errno != EEXIST)
+    {
+        return;
+    }
+
+    char tmp_path[PATH_MAX + 8];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.XXXXXX", cache_path);
+    int fd = mkstemp(tmp_path);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    PixelCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PIXEL_CACHE_MAGIC, 4);
+    header.version = PIXEL_CACHE_VERSION;
+    header.width = (uint32_t)image->w;
+    header.height = (uint32_t)image->h;
+    header.pitch = (uint32_t)image->w * 4u;
+    fill_source_stamp(&header, &src);
+
+    int ok = write_all(fd, &header, sizeof(header)) == 0;
+    const unsigned char *row = (const unsigned char *)image->pixels;
+    for (int y = 0; ok && y < image->h; ++y, row += image->pitch)
+    {
+        ok = write_all(fd, row, header.pitch) == 0;
+    }
+    ok = (close(fd) == 0) && ok;
+
+    if (!ok || rename(tmp_path, cache_path) != 0)
+    {
+        unlink(tmp_path);
+    }
+}
+
+void pixel_cache_get_stats(int *hits, int *misses)
+{
+    if (hits)
+        *hits = atomic_load(&g_hits);
+    if (misses)
+        *misses = atomic_load(&g_misses);
+}
@@ -3,6 +3,7 @@
 
 #include "../include/player.h"
 #include "../include/collision.h"
+#include "../include/move_field.h"
 
 // 플레이어 로직
 // - 입력은 목표 좌표로 바꿔서 처리
@@ -40,6 +41,8 @@ void init_player(Player *p, const Stage *stage)
     // move_speed: 초당 서브픽셀
     p->world_x = stage->start_x * SUBPIXELS_PER_TILE;
     p->world_y = stage->start_y * SUBPIXELS_PER_TILE;
+    p->prev_world_x = p->world_x;
+    p->prev_world_y = p->world_y;
     p->target_world_x = p->world_x;
     p->target_world_y = p->world_y;
 
@@ -99,6 +102,48 @@ static int tile_is_passable(const Stage *stage, int tile_x, int tile_y)
     return 1;
 }
 
+static int floor_div(int value, int divisor)
+{
+    int q = value / divisor;
+    if ((value % divisor != 0) && ((value < 0) != (divisor < 0)))
+        q--;
+    return q;
+}
+
+// 진행 방향 앞 타일이 비어 있는지. 비트맵이 있으면 비트 하나 조회
+static int is_front_tile_clear(const Stage *stage, int tile_x, int tile_y)
+{
+    if (!stage->move_field)
+        return tile_is_passable(stage, tile_x, tile_y);
+    return move_field_is_open(stage->move_field, tile_x, tile_y);
+}
+
+// 앞 타일 줄(front_tile)에서 진행 방향에 수직인 [span_start, span_start + span_len) 서브픽셀 중
+// 지나갈 수 있는 픽셀 수. 타일 단위로 묶어 세므로 타일당 조회 한 번 (플레이어 폭이면 최대 2타일)
+// - dir_x가 0이 아니면 좌우 이동(front_tile은 열), 0이면 상하 이동(front_tile은 행)
+static int count_clear_span(const Stage *stage, int dir_x, int front_tile, int span_start, int span_len)
+{
+    const int tile_size = SUBPIXELS_PER_TILE;
+    const int span_end = span_start + span_len;
+    int clear = 0;
+
+    for (int pos = span_start; pos < span_end;)
+    {
+        int tile = floor_div(pos, tile_size);
+        int next = (tile + 1) * tile_size;
+        if (next > span_end)
+            next = span_end;
+
+        int tile_x = (dir_x != 0) ? front_tile : tile;
+        int tile_y = (dir_x != 0) ? tile : front_tile;
+        if (is_front_tile_clear(stage, tile_x, tile_y))
+            clear += next - pos;
+
+        pos = next;
+    }
+    return clear;
+}
+
 static int count_front_free_pixels(const Player *p, const Stage *stage, int dir_x, int dir_y)
 {
     if (!p || !stage)
@@ -116,21 +161,7 @@ static int count_front_free_pixels(const Player *p, const Stage *stage, int dir_
         if (front_x < 0 || front_x >= world_limit_x)
             return 0;
 
-        int free_pixels = 0;
-        for (int offset = 0; offset < tile_size; ++offset)
-        {
-            int sample_y = p->world_y + offset;
-            if (sample_y < 0 || sample_y >= world_limit_y)
-                continue;
-
-            int tile_x = front_x / tile_size;
-            int tile_y = sample_y / tile_size;
-            if (tile_is_passable(stage, tile_x, tile_y))
-            {
-                free_pixels++;
-            }
-        }
-        return free_pixels;
+        return count_clear_span(stage, dir_x, front_x / tile_size, p->world_y, tile_size);
     }
 
     if (dir_y != 0)
@@ -139,21 +170,7 @@ static int count_front_free_pixels(const Player *p, const Stage *stage, int dir_
         if (front_y < 0 || front_y >= world_limit_y)
             return 0;
 
-        int free_pixels = 0;
-        for (int offset = 0; offset < tile_size; ++offset)
-        {
-            int sample_x = p->world_x + offset;
-            if (sample_x < 0 || sample_x >= world_limit_x)
-                continue;
-
-            int tile_x = sample_x / tile_size;
-            int tile_y = front_y / tile_size;
-            if (tile_is_passable(stage, tile_x, tile_y))
-            {
-                free_pixels++;
-            }
-        }
-        return free_pixels;
+        return count_clear_span(stage, 0, front_y / tile_size, p->world_x, tile_size);
     }
 
     return 0;
@@ -241,6 +258,7 @@ static int edge_is_clear(const Player *p, const Stage *stage,
     const int world_limit_x = stage_width * tile_size;
     const int world_limit_y = stage_height * tile_size;
     const int edge_span = 2;
+    const int start_offset = (edge_sign < 0) ? 0 : (tile_size - edge_span);
 
     if (dir_x != 0)
     {
@@ -248,22 +266,8 @@ static int edge_is_clear(const Player *p, const Stage *stage,
         if (front_x < 0 || front_x >= world_limit_x)
             return 0;
 
-        int start_offset = (edge_sign < 0) ? 0 : (tile_size - edge_span);
-        int clear_pixels = 0;
-        for (int i = 0; i < edge_span; ++i)
-        {
-            int sample_y = p->world_y + start_offset + i;
-            if (sample_y < 0 || sample_y >= world_limit_y)
-                continue;
-
-            int tile_x = front_x / tile_size;
-            int tile_y = sample_y / tile_size;
-            if (tile_is_passable(stage, tile_x, tile_y))
-            {
-                clear_pixels++;
-            }
-        }
-        return (clear_pixels == edge_span);
+        return count_clear_span(stage, dir_x, front_x / tile_size,
+                                p->world_y + start_offset, edge_span) == edge_span;
     }
     else if (dir_y != 0)
     {
@@ -271,22 +275,8 @@ static int edge_is_clear(const Player *p, const Stage *stage,
         if (front_y < 0 || front_y >= world_limit_y)
             return 0;
 
-        int start_offset = (edge_sign < 0) ? 0 : (tile_size - edge_span);
-        int clear_pixels = 0;
-        for (int i = 0; i < edge_span; ++i)
-        {
-            int sample_x = p->world_x + start_offset + i;
-            if (sample_x < 0 || sample_x >= world_limit_x)
-                continue;
-
-            int tile_x = sample_x / tile_size;
-            int tile_y = front_y / tile_size;
-            if (tile_is_passable(stage, tile_x, tile_y))
-            {
-                clear_pixels++;
-            }
-        }
-        return (clear_pixels == edge_span);
+        return count_clear_span(stage, 0, front_y / tile_size,
+                                p->world_x + start_offset, edge_span) == edge_span;
     }
 
     return 0;
@@ -4,6 +4,9 @@
 #include "../include/professor_pattern.h"
 #include "../include/sound.h"
 #include "../include/player.h"
+#include "../include/hazard.h"
+#include "../include/log.h"
+#include "../include/trace.h"
 #include <stdio.h>
 #include <math.h>
 #include <stdlib.h>
@@ -61,6 +64,10 @@ static void clear_professor_clones(Stage *stage)
     }
     memset(stage->professor_clones, 0, sizeof(stage->professor_clones));
     stage->num_professor_clones = 0;
+    for (int i = 0; i < MAX_PROFESSOR_CLONES; ++i)
+    {
+        hazard_sync_clone(stage, i);
+    }
 }
 
 static void decay_professor_clones(Stage *stage, double delta_time)
@@ -90,6 +97,7 @@ static void decay_professor_clones(Stage *stage, double delta_time)
             if (clone->remaining_time <= 0.0)
             {
                 clone->active = 0;
+                hazard_sync_clone(stage, i);
                 continue;
             }
         }
@@ -123,67 +131,60 @@ static int tile_overlaps_player(const Player *player, int tx, int ty)
     return 1;
 }
 
-static int tile_has_professor_clone(const Stage *stage, int tx, int ty)
+// 분신 소환용 점유 격자
+// - 시전할 때마다 스탬프를 올리고 장애물/아이템/분신 칸만 표시 (O(엔티티 수), 격자 전체 초기화 없음)
+// - 패턴 단계는 시뮬레이션 스레드에서만 돌므로 정적 버퍼 하나로 충분
+static unsigned short g_clone_occupancy[MAX_Y][MAX_X];
+static unsigned short g_clone_occupancy_stamp;
+
+static void mark_clone_occupied(int tx, int ty)
 {
-    if (!stage)
+    if (tx < 0 || ty < 0 || tx >= MAX_X || ty >= MAX_Y)
     {
-        return 0;
-    }
-    for (int i = 0; i < MAX_PROFESSOR_CLONES; ++i)
-    {
-        const ProfessorClone *clone = &stage->professor_clones[i];
-        if (clone->active && clone->tile_x == tx && clone->tile_y == ty)
-        {
-            return 1;
-        }
+        return;
     }
-    return 0;
+    g_clone_occupancy[ty][tx] = g_clone_occupancy_stamp;
 }
 
-static int tile_has_obstacle(const Stage *stage, int tx, int ty)
+static int is_clone_tile_occupied(int tx, int ty)
 {
-    if (!stage)
+    return g_clone_occupancy[ty][tx] == g_clone_occupancy_stamp;
+}
+
+static void build_clone_occupancy(const Stage *stage)
+{
+    if (++g_clone_occupancy_stamp == 0)
     {
-        return 0;
+        memset(g_clone_occupancy, 0, sizeof(g_clone_occupancy));
+        g_clone_occupancy_stamp = 1;
     }
+
     for (int i = 0; i < stage->num_obstacles; ++i)
     {
         const Obstacle *o = &stage->obstacles[i];
-        if (!o->active)
+        if (o->active)
         {
-            continue;
-        }
-        int ox = o->world_x / SUBPIXELS_PER_TILE;
-        int oy = o->world_y / SUBPIXELS_PER_TILE;
-        if (ox == tx && oy == ty)
-        {
-            return 1;
+            mark_clone_occupied(o->world_x / SUBPIXELS_PER_TILE, o->world_y / SUBPIXELS_PER_TILE);
         }
     }
-    return 0;
-}
 
-static int tile_has_item(const Stage *stage, int tx, int ty)
-{
-    if (!stage)
-    {
-        return 0;
-    }
     for (int i = 0; i < stage->num_items; ++i)
     {
         const Item *it = &stage->items[i];
-        if (!it->active)
+        if (it->active)
         {
-            continue;
+            mark_clone_occupied(it->world_x / SUBPIXELS_PER_TILE, it->world_y / SUBPIXELS_PER_TILE);
         }
-        int ix = it->world_x / SUBPIXELS_PER_TILE;
-        int iy = it->world_y / SUBPIXELS_PER_TILE;
-        if (ix == tx && iy == ty)
+    }
+
+    for (int i = 0; i < MAX_PROFESSOR_CLONES; ++i)
+    {
+        const ProfessorClone *clone = &stage->professor_clones[i];
+        if (clone->active)
         {
-            return 1;
+            mark_clone_occupied(clone->tile_x, clone->tile_y);
         }
     }
-    return 0;
 }
 
 static int add_professor_clone(Stage *stage, int tx, int ty, double ttl)
@@ -204,6 +205,7 @@ static int add_professor_clone(Stage *stage, int tx, int ty, double ttl)
         clone->tile_y = ty;
         clone->remaining_time = ttl;
         clone->active = 1;
+        hazard_sync_clone(stage, i);
         stage->num_professor_clones++;
         return 1;
     }
@@ -223,52 +225,53 @@ static int spawn_professor_clones(Stage *stage, const Player *player, const Obst
         return 0;
     }
     // 소환 후보: 지나갈 수 있는 타일 중에서 겹치지 않는 곳
+    // - 캐시된 passable_tiles에서 무작위로 뽑고 점유된 칸이면 다시 뽑음 (기대 O(k))
+    // - 맵이 거의 꽉 차 재시도가 한도를 넘으면 무작위 시작점부터 한 바퀴 훑어 나머지를 채움
+    build_clone_occupancy(stage);
 
-    short candidate_indices[MAX_PASSABLE_TILES];
-    int available = 0;
+    const int count = stage->num_passable_tiles;
+    int created = 0;
+    int attempts = desired_count * 8 + 32;
 
-    for (int i = 0; i < stage->num_passable_tiles; ++i)
-    {
-        int x = stage->passable_tiles[i].x;
-        int y = stage->passable_tiles[i].y;
+    // 첫 묶음은 서로 다른 후보로 뽑아 같은 칸 중복 추첨을 줄임
+    int picks[MAX_PROFESSOR_CLONES];
+    int num_picks = rng_pick_distinct(&stage->rng, count,
+                                      desired_count < MAX_PROFESSOR_CLONES ? desired_count : MAX_PROFESSOR_CLONES,
+                                      picks);
 
-        if (tile_overlaps_player(player, x, y))
-        {
-            continue;
-        }
-        if (tile_has_obstacle(stage, x, y))
-        {
-            continue;
-        }
-        if (tile_has_item(stage, x, y))
-        {
-            continue;
-        }
-        if (tile_has_professor_clone(stage, x, y))
+    for (int n = 0; created < desired_count && attempts-- > 0; ++n)
+    {
+        int index = (n < num_picks) ? picks[n] : rng_below(&stage->rng, count);
+        TileCoord chosen = stage->passable_tiles[index];
+        if (is_clone_tile_occupied(chosen.x, chosen.y) || tile_overlaps_player(player, chosen.x, chosen.y))
         {
             continue;
         }
-
-        candidate_indices[available++] = (short)i;
-        if (available >= MAX_PASSABLE_TILES)
+        if (!add_professor_clone(stage, chosen.x, chosen.y, ttl))
         {
-            break;
+            break; // 분신 슬롯이 가득 참
         }
+        mark_clone_occupied(chosen.x, chosen.y);
+        created++;
     }
 
-    int created = 0;
-    while (created < desired_count && available > 0)
+    if (created < desired_count && attempts < 0)
     {
-        int pick = rand() % available;
-        int index = candidate_indices[pick];
-        TileCoord chosen = stage->passable_tiles[index];
-        if (add_professor_clone(stage, chosen.x, chosen.y, ttl))
+        int start = rng_below(&stage->rng, count);
+        for (int n = 0; n < count && created < desired_count; ++n)
         {
+            TileCoord chosen = stage->passable_tiles[(start + n) % count];
+            if (is_clone_tile_occupied(chosen.x, chosen.y) || tile_overlaps_player(player, chosen.x, chosen.y))
+            {
+                continue;
+            }
+            if (!add_professor_clone(stage, chosen.x, chosen.y, ttl))
+            {
+                break;
+            }
+            mark_clone_occupied(chosen.x, chosen.y);
             created++;
         }
-
-        candidate_indices[pick] = candidate_indices[available - 1];
-        available--;
     }
 
     (void)prof;
@@ -277,12 +280,14 @@ static int spawn_professor_clones(Stage *stage, const Player *player, const Obst
 
 static void cast_b1_skill_a(Stage *stage, const Player *player, const Obstacle *prof)
 {
+    trace_instant("B1 skill A (clones)", "pattern");
     spawn_professor_clones(stage, player, prof, kB1ClonesPerCast, kB1SkillACloneLifetime);
     play_sfx_nonblocking(kB1SkillASfx);
 }
 
 static void cast_b1_skill_b(Stage *stage, const Player *player, const Obstacle *prof)
 {
+    trace_instant("B1 skill B (clones)", "pattern");
     spawn_professor_clones(stage, player, prof, kB1ClonesPerCast, kB1SkillBCloneLifetime);
     play_sfx_nonblocking(kB1SkillBSfx);
 }
@@ -339,10 +344,13 @@ static void spawn_stage3_bullet(Stage *stage, const Obstacle *prof, const Player
 
     slot->world_x = origin_x - 0.5;
     slot->world_y = origin_y - 0.5;
+    slot->prev_world_x = slot->world_x;
+    slot->prev_world_y = slot->world_y;
     slot->vel_x = dir_x * kStage3BulletSpeed;
     slot->vel_y = dir_y * kStage3BulletSpeed;
     slot->remaining_time = kStage3BulletLifetime;
     slot->active = 1;
+    hazard_sync_bullet(stage, (int)(slot - stage->professor_bullets));
     if (stage->num_professor_bullets < MAX_PROFESSOR_BULLETS)
     {
         stage->num_professor_bullets++;
@@ -418,49 +426,48 @@ ProfessorBulletResult update_professor_bullets(Stage *stage, Player *player, dou
         if (bullet->remaining_time <= 0.0)
         {
             bullet->active = 0;
-            continue;
         }
-
-        double center_x = bullet->world_x + 0.5;
-        double center_y = bullet->world_y + 0.5;
-        int tile_x = (int)floor(center_x);
-        int tile_y = (int)floor(center_y);
-        if (tile_x < 0 || tile_y < 0 || tile_x >= width || tile_y >= height)
+        else
         {
-            bullet->active = 0;
-            continue;
+            int tile_x = (int)floor(bullet->world_x + 0.5);
+            int tile_y = (int)floor(bullet->world_y + 0.5);
+            if (tile_x < 0 || tile_y < 0 || tile_x >= width || tile_y >= height ||
+                is_tile_impassable_char(stage->map[tile_y][tile_x]))
+            {
+                bullet->active = 0;
+            }
         }
 
-        if (is_tile_impassable_char(stage->map[tile_y][tile_x]))
+        hazard_sync_bullet(stage, i);
+        if (bullet->active)
         {
-            bullet->active = 0;
-            continue;
+            active_count++;
         }
+    }
+
+    // 플레이어 피격: 이동을 마친 탄환 중심점을 SoA로 한 번에 판정, 인덱스 순으로 쉴드 소모
+    uint64_t hits = player ? hazard_bullet_hits(stage, player) : 0;
+    while (hits)
+    {
+        int i = __builtin_ctzll(hits);
+        hits &= hits - 1;
 
-        if (player)
+        stage->professor_bullets[i].active = 0;
+        hazard_sync_bullet(stage, i);
+        active_count--;
+
+        if (player->shield_count > 0)
         {
-            int center_world_x = (int)lround(center_x * SUBPIXELS_PER_TILE);
-            int center_world_y = (int)lround(center_y * SUBPIXELS_PER_TILE);
-            if (is_world_point_inside_player(player, center_world_x, center_world_y))
+            player->shield_count--;
+            if (result != PROFESSOR_BULLET_RESULT_FATAL)
             {
-                bullet->active = 0;
-                if (player->shield_count > 0)
-                {
-                    player->shield_count--;
-                    if (result != PROFESSOR_BULLET_RESULT_FATAL)
-                    {
-                        result = PROFESSOR_BULLET_RESULT_SHIELD_BLOCKED;
-                    }
-                }
-                else
-                {
-                    result = PROFESSOR_BULLET_RESULT_FATAL;
-                }
-                continue;
+                result = PROFESSOR_BULLET_RESULT_SHIELD_BLOCKED;
             }
         }
-
-        active_count++;
+        else
+        {
+            result = PROFESSOR_BULLET_RESULT_FATAL;
+        }
     }
 
     stage->num_professor_bullets = active_count;
@@ -683,8 +690,8 @@ int pattern_stage_2f(Stage *stage, Obstacle *prof, Player *player, double delta_
             int player_tile_y = prof->world_y / TILE_SIZE;
 
             // 임시 목표 (현재 맵 타일이 벽인지 검사하는 로직이 필요하지만, 여기서는 단순화)
-            int block_x = player_tile_x + (rand() % 3) - 1; // 플레이어 근처 1칸 이내
-            int block_y = player_tile_y + (rand() % 3) - 1;
+            int block_x = player_tile_x + rng_range(&stage->rng, -1, 1); // 플레이어 근처 1칸 이내
+            int block_y = player_tile_y + rng_range(&stage->rng, -1, 1);
 
             // B. 순간 이동
             prof->world_x = block_x * TILE_SIZE;
@@ -694,8 +701,8 @@ int pattern_stage_2f(Stage *stage, Obstacle *prof, Player *player, double delta_
             prof->target_world_x = prof->world_x;
             prof->target_world_y = prof->world_y;
 
-            printf("플레이어 발각! 교수님 (%d, %d)로 순간이동.\n", block_x, block_y);
-            fflush(stdout);
+            trace_instant("2F teleport", "pattern");
+            LOG_DEBUG(LOG_CAT_PATTERN, "플레이어 발각! 교수님 (%d, %d)로 순간이동.", block_x, block_y);
         }
 
         // 1.0초 동안 정지 (경로 차단 효과)
@@ -765,6 +772,7 @@ int pattern_stage_3f(Stage *stage, Obstacle *prof, Player *player, double delta_
             prof->p_timer = 0.0;
             prof->p_counter = 0;
             prof->p_state = STAGE3_STATE_FIRING;
+            trace_instant("3F skill 1 (burst)", "pattern");
             const char *skill1_sfx = resolve_professor_sfx(kStage3Skill1Sfx, kStage3Skill1Fallback);
             play_sfx_nonblocking(skill1_sfx);
         }
@@ -799,6 +807,7 @@ int pattern_stage_3f(Stage *stage, Obstacle *prof, Player *player, double delta_
         if (swap_timer_ms >= swap_cooldown_ms)
         {
             swap_timer_ms = 0;
+            trace_instant("3F skill 2 (swap)", "pattern");
             const char *skill2_sfx = resolve_professor_sfx(kStage3Skill2Sfx, kStage3Skill2Fallback);
             play_sfx_nonblocking(skill2_sfx);
             swap_professor_with_player(prof, player);
@@ -964,6 +973,7 @@ int pattern_stage_5f(Stage *stage, Obstacle *prof, Player *player, double delta_
         // 4.0초가 되는 순간 실행
         if (loop_time - 4.0 < delta_time * 1.5)
         {
+            trace_instant("5F clones", "pattern");
             spawn_professor_clones(stage, player, prof, NERFED_CLONE_COUNT, 3.0);
 
             should_move = 0;
@@ -1,5 +1,7 @@
 // projectile.c
 #include "../include/game.h"
+#include "../include/hazard.h"
+#include "../include/stage.h"
 #include <stdio.h>
 
 void fire_projectile(Stage *stage, const Player *player) // 플레이어 투사체 발사 함수
@@ -61,10 +63,13 @@ void fire_projectile(Stage *stage, const Player *player) // 플레이어 투사
     Projectile *p = &stage->projectiles[slot_index]; //투사체 정보 초기화.
     p->world_x = player->world_x;
     p->world_y = player->world_y;
+    p->prev_world_x = p->world_x;
+    p->prev_world_y = p->world_y;
     p->dir_x = dir_x;
     p->dir_y = dir_y;
     p->active = 1;
-    p->distance_traveled = 0;
+    p->tiles_traveled = 0;
+    p->move_remainder = 0.0;
 }
 
 static int is_wall_cell(const Stage *stage, int tile_x, int tile_y)
@@ -83,13 +88,89 @@ static int is_wall_cell(const Stage *stage, int tile_x, int tile_y)
     return is_tile_impassable_char(cell); // @,#,w,W,m,M,l,L은 물리적으로 막힘
 }
 
-void move_projectiles(Stage *stage)
+// 해당 타일에 있는 장애물을 맞히면 피해를 주고 1
+static int hit_obstacle_at(Stage *stage, int tile_x, int tile_y)
 {
-    if (!stage)
+    for (int j = 0; j < stage->num_obstacles; j++)
+    {
+        Obstacle *o = &stage->obstacles[j];
+        if (!o->active)
+            continue;
+
+        if (o->kind == OBSTACLE_KIND_PROFESSOR && stage->id != 6) // 6스테이지에서는 교수 맞추기 가능
+            continue;
+
+        int obstacle_tile_x = o->world_x / SUBPIXELS_PER_TILE;
+        int obstacle_tile_y = o->world_y / SUBPIXELS_PER_TILE;
+        if (obstacle_tile_x != tile_x || obstacle_tile_y != tile_y)
+            continue;
+
+        o->hp--;   //hp 1 감소
+        if (o->hp <= 0)
+        {
+            o->active = 0;  //hp 없으면 죽음
+            hazard_sync_obstacle(stage, j);
+            if (o->kind == OBSTACLE_KIND_BREAKABLE_WALL)
+                stage_on_breakable_wall_destroyed(stage, obstacle_tile_x, obstacle_tile_y);
+        }
+        return 1;
+    }
+    return 0;
+}
+
+// 다음 타일 경계까지 남은 이동량 (서브픽셀). 그 축으로 움직이지 않으면 -1
+static int distance_to_tile_boundary(int world, int dir)
+{
+    int tile_start = (world / SUBPIXELS_PER_TILE) * SUBPIXELS_PER_TILE;
+    if (dir > 0)
+        return tile_start + SUBPIXELS_PER_TILE - world;
+    if (dir < 0)
+        return world - tile_start + 1;
+    return -1;
+}
+
+// 이번 틱 경로(step 서브픽셀)가 지나가는 타일을 순서대로 훑음
+// - 투사체는 한 축으로만 움직이므로 (fire_projectile이 dir_x/dir_y 중 하나만 설정) 그 축의 타일 경계만 차례로 넘음
+// - 시작 타일: 직전 틱 뒤에 장애물이 들어왔을 수 있으므로 장애물만 판정
+// - 새로 들어가는 타일: 벽 → 장애물 순
+// - 사거리는 들어간 타일 수로 셈 (타일 안 위치/방향과 무관하게 max_tiles칸까지)
+// 무언가에 맞았거나 사거리를 넘으면 1 (p->active는 호출한 쪽이 끔)
+static int sweep_projectile(Stage *stage, Projectile *p, int step, int max_tiles)
+{
+    int tile_x = p->world_x / SUBPIXELS_PER_TILE;
+    int tile_y = p->world_y / SUBPIXELS_PER_TILE;
+    if (hit_obstacle_at(stage, tile_x, tile_y))
+        return 1;
+
+    const int along_x = (p->dir_x != 0);
+    int next = along_x ? distance_to_tile_boundary(p->world_x, p->dir_x)
+                       : distance_to_tile_boundary(p->world_y, p->dir_y);
+    for (; next >= 0 && next <= step; next += SUBPIXELS_PER_TILE)
+    {
+        if (p->tiles_traveled >= max_tiles) // 다음 타일이 사거리 밖
+            return 1;
+        p->tiles_traveled++;
+
+        if (along_x)
+            tile_x += p->dir_x;
+        else
+            tile_y += p->dir_y;
+
+        if (is_wall_cell(stage, tile_x, tile_y)) //벽 충돌 검사
+            return 1;
+        if (hit_obstacle_at(stage, tile_x, tile_y)) //장애물 충돌 검사
+            return 1;
+    }
+    return 0;
+}
+
+void move_projectiles(Stage *stage, double dt)
+{
+    if (!stage || dt <= 0.0)
         return;
 
-    const int step = SUBPIXELS_PER_TILE; //1프레임당 이동거리 (1타일)
-    int max_range_pixels = CONSTANT_PROJECTILE_RANGE * SUBPIXELS_PER_TILE; // 최대 사거리
+    const double distance = PROJECTILE_SPEED_TILES_PER_SEC * SUBPIXELS_PER_TILE * dt; // 이번 틱 이동량 (서브픽셀)
+    const int max_tiles = CONSTANT_PROJECTILE_RANGE - 1; // 최대 사거리 (발사 칸 제외, 틱당 1타일이던 때와 같음)
 
     for (int i = 0; i < stage->num_projectiles; i++)
     {
@@ -97,55 +178,17 @@ void move_projectiles(Stage *stage)
         if (!p->active)
             continue;
 
-        int next_world_x = p->world_x + p->dir_x * step;  //현재 투사체 위치 임시 저장
-        int next_world_y = p->world_y + p->dir_y * step;
-
-        p->distance_traveled += step; // 이동 거리 누적
-
-        if (p->distance_traveled >= max_range_pixels)  // 사거리 초과 -> 소멸
-        {
-            p->active = 0; 
-            continue;
-        }
-
-        int next_tile_x = next_world_x / SUBPIXELS_PER_TILE;
-        int next_tile_y = next_world_y / SUBPIXELS_PER_TILE;
+        double travel = distance + p->move_remainder;
+        int step = (int)travel;
+        p->move_remainder = travel - step;
 
-        if (is_wall_cell(stage, next_tile_x, next_tile_y)) //벽 충돌 검사
+        if (sweep_projectile(stage, p, step, max_tiles))
         {
             p->active = 0;
             continue;
         }
 
-        // 장애물 충돌 체크
-        for (int j = 0; j < stage->num_obstacles; j++)
-        {
-            Obstacle *o = &stage->obstacles[j];
-            if (!o->active)
-                continue;
-
-            if (o->kind == OBSTACLE_KIND_PROFESSOR && stage->id != 6) // 6스테이지에서는 교수 맞추기 가능
-                continue;  
-
-            int obstacle_tile_x = o->world_x / SUBPIXELS_PER_TILE;
-            int obstacle_tile_y = o->world_y / SUBPIXELS_PER_TILE;
-
-            if (obstacle_tile_x == next_tile_x && obstacle_tile_y == next_tile_y) //장애물 충돌 검사
-            {
-                o->hp--;   //hp 1 감소
-                if (o->hp <= 0)
-                {
-                    o->active = 0;  //hp 없으면 죽음
-                }
-                p->active = 0;
-                break;
-            }
-        }
-
-        if (!p->active)
-            continue;
-
-        p->world_x = next_world_x;
-        p->world_y = next_world_y;
+        p->world_x += p->dir_x * step;
+        p->world_y += p->dir_y * step;
     }
 }
@@ -0,0 +1,283 @@
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/pvs.h"
+#include "../include/job_system.h"
+
+#define PVS_JOB_GRAIN 1 // 출발 타일 한 줄 단위
+
+struct Pvs
+{
+    int width;
+    int height;
+    atomic_uchar *opaque;     // [height][width], 1이면 시선 차단
+    atomic_uint_fast64_t *bits; // [height][width][PVS_ROWS], 행 안의 비트 (dx + PVS_RADIUS_X)
+};
+
+static inline atomic_uint_fast64_t *source_rows(const struct Pvs *pvs, int x, int y)
+{
+    return &pvs->bits[((size_t)y * pvs->width + x) * PVS_ROWS];
+}
+
+static inline int is_opaque(const struct Pvs *pvs, int x, int y)
+{
+    if (x < 0 || y < 0 || x >= pvs->width || y >= pvs->height)
+        return 1;
+    return atomic_load_explicit(&pvs->opaque[(size_t)y * pvs->width + x], memory_order_relaxed);
+}
+
+// 렌더러가 쓰던 Bresenham 시선 판정과 동일 (출발/도착 칸 자체는 검사하지 않음)
+static int trace_line_of_sight(const struct Pvs *pvs, int start_x, int start_y, int target_x, int target_y)
+{
+    if (target_x < 0 || target_y < 0 || target_x >= pvs->width || target_y >= pvs->height)
+        return 0;
+
+    int x0 = start_x;
+    int y0 = start_y;
+    int dx = abs(target_x - x0);
+    int sx = (x0 < target_x) ? 1 : -1;
+    int dy = -abs(target_y - y0);
+    int sy = (y0 < target_y) ? 1 : -1;
+    int err = dx + dy;
+
+    while (1)
+    {
+        if (!(x0 == start_x && y0 == start_y) && (x0 != target_x || y0 != target_y))
+        {
+            if (is_opaque(pvs, x0, y0))
+                return 0;
+        }
+
+        if (x0 == target_x && y0 == target_y)
+            break;
+
+        int e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+    return 1;
+}
+
+static void build_source(struct Pvs *pvs, int sx, int sy)
+{
+    atomic_uint_fast64_t *rows = source_rows(pvs, sx, sy);
+    for (int r = 0; r < PVS_ROWS; ++r)
+    {
+        int ty = sy + r - PVS_RADIUS_Y;
+        uint64_t row = 0;
+        if (ty >= 0 && ty < pvs->height)
+        {
+            for (int dx = -PVS_RADIUS_X; dx <= PVS_RADIUS_X; ++dx)
+            {
+                int tx = sx + dx;
+                if (tx < 0 || tx >= pvs->width)
+                    continue;
+                if (trace_line_of_sight(pvs, sx, sy, tx, ty))
+                    row |= (uint64_t)1 << (dx + PVS_RADIUS_X);
+            }
+        }
+        atomic_store_explicit(&rows[r], row, memory_order_relaxed);
+    }
+}
+
+static void build_rows_job(void *ctx, int begin, int end, int worker)
+{
+    (void)worker;
+    struct Pvs *pvs = (struct Pvs *)ctx;
+    for (int y = begin; y < end; ++y)
+    {
+        for (int x = 0; x < pvs->width; ++x)
+        {
+            build_source(pvs, x, y);
+        }
+    }
+}
+
+struct Pvs *pvs_build(const Stage *stage)
+{
+    if (!stage)
+        return NULL;
+
+    int width = (stage->width > 0) ? stage->width : MAX_X;
+    int height = (stage->height > 0) ? stage->height : MAX_Y;
+
+    struct Pvs *pvs = calloc(1, sizeof(*pvs));
+    if (!pvs)
+        return NULL;
+
+    pvs->width = width;
+    pvs->height = height;
+    pvs->opaque = calloc((size_t)width * height, sizeof(*pvs->opaque));
+    pvs->bits = calloc((size_t)width * height * PVS_ROWS, sizeof(*pvs->bits));
+    if (!pvs->opaque || !pvs->bits)
+    {
+        pvs_destroy(pvs);
+        return NULL;
+    }
+
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            atomic_init(&pvs->opaque[(size_t)y * width + x], is_tile_opaque_char(stage->map[y][x]) ? 1 : 0);
+        }
+    }
+
+    // 깨지는 벽은 맵에는 공백이지만 보기에는 벽이므로 시선을 막음
+    for (int i = 0; i < stage->num_obstacles; ++i)
+    {
+        const Obstacle *o = &stage->obstacles[i];
+        if (!o->active || o->kind != OBSTACLE_KIND_BREAKABLE_WALL)
+            continue;
+        int tx = o->world_x / SUBPIXELS_PER_TILE;
+        int ty = o->world_y / SUBPIXELS_PER_TILE;
+        if (tx >= 0 && ty >= 0 && tx < width && ty < height)
+            atomic_store(&pvs->opaque[(size_t)ty * width + tx], 1);
+    }
+
+    job_system_parallel_for(height, PVS_JOB_GRAIN, build_rows_job, pvs);
+    return pvs;
+}
+
+void pvs_destroy(struct Pvs *pvs)
+{
+    if (!pvs)
+        return;
+    free(pvs->opaque);
+    free(pvs->bits);
+    free(pvs);
+}
+
+int pvs_can_see(const struct Pvs *pvs, int from_x, int from_y, int to_x, int to_y)
+{
+    if (!pvs)
+        return 1;
+    if (from_x < 0 || from_y < 0 || from_x >= pvs->width || from_y >= pvs->height)
+        return 0;
+
+    int dx = to_x - from_x;
+    int dy = to_y - from_y;
+    if (dx < -PVS_RADIUS_X || dx > PVS_RADIUS_X || dy < -PVS_RADIUS_Y || dy > PVS_RADIUS_Y)
+        return trace_line_of_sight(pvs, from_x, from_y, to_x, to_y);
+
+    uint64_t row = atomic_load_explicit(&source_rows(pvs, from_x, from_y)[dy + PVS_RADIUS_Y], memory_order_relaxed);
+    return (int)((row >> (dx + PVS_RADIUS_X)) & 1u);
+}
+
+void pvs_fill_visibility(const struct Pvs *pvs, int center_x, int center_y,
+                         unsigned char visibility[MAX_Y][MAX_X])
+{
+    memset(visibility, 0, sizeof(unsigned char) * MAX_Y * MAX_X);
+    if (!pvs || center_x < 0 || center_y < 0 || center_x >= pvs->width || center_y >= pvs->height)
+        return;
+
+    const atomic_uint_fast64_t *rows = source_rows(pvs, center_x, center_y);
+    for (int r = 0; r < PVS_ROWS; ++r)
+    {
+        int ty = center_y + r - PVS_RADIUS_Y;
+        if (ty < 0 || ty >= pvs->height || ty >= MAX_Y)
+            continue;
+
+        uint64_t row = atomic_load_explicit(&rows[r], memory_order_relaxed);
+        while (row)
+        {
+            int bit = __builtin_ctzll(row);
+            row &= row - 1;
+            int tx = center_x + bit - PVS_RADIUS_X;
+            if (tx >= 0 && tx < MAX_X)
+                visibility[ty][tx] = 1;
+        }
+    }
+}
+
+typedef struct
+{
+    struct Pvs *pvs;
+    int open_x;
+    int open_y;
+    int min_sx;
+    int min_sy;
+    int span_x;
+} PvsPatchJob;
+
+// 출발 타일 s에서 열린 칸 w를 지나갈 수 있는, 현재 안 보이는 타일만 다시 계산
+// (투명해지는 변화이므로 보이던 칸이 안 보이게 되는 경우는 없음)
+static void patch_source(struct Pvs *pvs, int sx, int sy, int wx, int wy)
+{
+    if (sx == wx && sy == wy)
+        return;
+
+    atomic_uint_fast64_t *rows = source_rows(pvs, sx, sy);
+    for (int r = 0; r < PVS_ROWS; ++r)
+    {
+        int ty = sy + r - PVS_RADIUS_Y;
+        if (ty < 0 || ty >= pvs->height)
+            continue;
+        // w가 s~t 경계 상자 안에 있어야 시선이 w를 지날 수 있음
+        if ((wy - sy) * (ty - wy) < 0)
+            continue;
+
+        uint64_t row = atomic_load_explicit(&rows[r], memory_order_relaxed);
+        uint64_t added = 0;
+        for (int dx = -PVS_RADIUS_X; dx <= PVS_RADIUS_X; ++dx)
+        {
+            if (row & ((uint64_t)1 << (dx + PVS_RADIUS_X)))
+                continue;
+            int tx = sx + dx;
+            if (tx < 0 || tx >= pvs->width)
+                continue;
+            if ((wx - sx) * (tx - wx) < 0)
+                continue;
+            if (tx == wx && ty == wy)
+                continue;
+            if (abs(tx - sx) < abs(wx - sx) || abs(ty - sy) < abs(wy - sy))
+                continue;
+            if (trace_line_of_sight(pvs, sx, sy, tx, ty))
+                added |= (uint64_t)1 << (dx + PVS_RADIUS_X);
+        }
+        if (added)
+            atomic_fetch_or_explicit(&rows[r], added, memory_order_relaxed);
+    }
+}
+
+static void patch_sources_job(void *ctx, int begin, int end, int worker)
+{
+    (void)worker;
+    PvsPatchJob *job = (PvsPatchJob *)ctx;
+    for (int i = begin; i < end; ++i)
+    {
+        int sx = job->min_sx + i % job->span_x;
+        int sy = job->min_sy + i / job->span_x;
+        patch_source(job->pvs, sx, sy, job->open_x, job->open_y);
+    }
+}
+
+void pvs_open_tile(struct Pvs *pvs, int tile_x, int tile_y)
+{
+    if (!pvs || tile_x < 0 || tile_y < 0 || tile_x >= pvs->width || tile_y >= pvs->height)
+        return;
+
+    atomic_uchar *cell = &pvs->opaque[(size_t)tile_y * pvs->width + tile_x];
+    if (!atomic_load(cell))
+        return;
+    atomic_store(cell, 0);
+
+    // 열린 칸을 박스 안에 두는 출발 타일만 영향을 받음
+    int min_sx = (tile_x - PVS_RADIUS_X > 0) ? tile_x - PVS_RADIUS_X : 0;
+    int max_sx = (tile_x + PVS_RADIUS_X < pvs->width - 1) ? tile_x + PVS_RADIUS_X : pvs->width - 1;
+    int min_sy = (tile_y - PVS_RADIUS_Y > 0) ? tile_y - PVS_RADIUS_Y : 0;
+    int max_sy = (tile_y + PVS_RADIUS_Y < pvs->height - 1) ? tile_y + PVS_RADIUS_Y : pvs->height - 1;
+
+    PvsPatchJob job = {pvs, tile_x, tile_y, min_sx, min_sy, max_sx - min_sx + 1};
+    int count = job.span_x * (max_sy - min_sy + 1);
+    job_system_parallel_for(count, 16, patch_sources_job, &job);
+}
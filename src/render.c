@@ -11,8 +11,41 @@
 #include <string.h>
 #include <unistd.h>
 
+#include "../include/asset_loader.h"
+#include "../include/capture.h"
+#include "../include/dirty_rect.h"
 #include "../include/game.h"
+#include "../include/glyph_atlas.h"
+#include "../include/pixel_cache.h"
+#include "../include/pvs.h"
 #include "../include/render.h"
+#include "../include/texture_cache.h"
+#include "../include/trace.h"
+
+// 성능 오버레이용 프레임당 SDL 그리기 호출 수 (이 파일의 모든 Render* 호출이 아래 매크로를 거침)
+// 소프트웨어 더티 사각형 경로에서는 render()가 그리는 동안 호출을 바로 그리지 않고 기록만 함
+static int g_draw_calls_this_frame = 0;
+static DirtyRectTracker *g_dirty = NULL; // 소프트웨어 렌더러일 때만 생성
+static int g_dirty_recording = 0;
+#define SDL_RenderClear(r) \
+    (++g_draw_calls_this_frame, g_dirty_recording ? dirty_rect_record_clear(g_dirty, (r)) : SDL_RenderClear(r))
+#define SDL_RenderCopy(r, t, s, d) \
+    (++g_draw_calls_this_frame, g_dirty_recording ? dirty_rect_record_copy(g_dirty, (r), (t), (s), (d)) : SDL_RenderCopy(r, t, s, d))
+#define SDL_RenderFillRect(r, rc) \
+    (++g_draw_calls_this_frame, g_dirty_recording ? dirty_rect_record_fill(g_dirty, (r), (rc)) : SDL_RenderFillRect(r, rc))
+#define SDL_RenderFillRects(r, rcs, n) \
+    (++g_draw_calls_this_frame, g_dirty_recording ? dirty_rect_record_fills(g_dirty, (r), (rcs), (n)) : SDL_RenderFillRects(r, rcs, n))
+#define SDL_RenderDrawRect(r, rc) \
+    (++g_draw_calls_this_frame, g_dirty_recording ? dirty_rect_record_outline(g_dirty, (r), (rc)) : SDL_RenderDrawRect(r, rc))
+#define SDL_RenderDrawLine(r, x1, y1, x2, y2) \
+    (++g_draw_calls_this_frame, g_dirty_recording ? dirty_rect_record_line(g_dirty, (r), (x1), (y1), (x2), (y2)) : SDL_RenderDrawLine(r, x1, y1, x2, y2))
+#define SDL_RenderDrawLines(r, pts, n) \
+    (++g_draw_calls_this_frame, g_dirty_recording ? dirty_rect_record_lines(g_dirty, (r), (pts), (n)) : SDL_RenderDrawLines(r, pts, n))
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+// 더티 사각형 기록 중에는 호출하지 않음 (draw_atlas_text가 쿼드마다 복사로 바꿔 그림)
+#define SDL_RenderGeometry(r, t, v, nv, i, ni) \
+    (++g_draw_calls_this_frame, SDL_RenderGeometry(r, t, v, nv, i, ni))
+#endif
 
 #define TILE_SIZE 32
 #define ARRAY_LEN(arr) ((int)(sizeof(arr) / sizeof((arr)[0])))
@@ -89,6 +122,7 @@ static const char *stage_label_for_id(int stage_id)
 
 static SDL_Window *g_window = NULL;
 static SDL_Renderer *g_renderer = NULL;
+static SDL_Surface *g_offscreen_surface = NULL; // 창 없이 그릴 때 소프트웨어 렌더러의 출력 (init_offscreen_renderer)
 static SDL_Texture *g_tex_floor = NULL;
 static SDL_Texture *g_tex_wall = NULL;
 static SDL_Texture *g_tex_goal = NULL;
@@ -129,6 +163,7 @@ static SDL_Texture *g_player_textures[PLAYER_VARIANT_COUNT][PLAYER_FACING_COUNT]
 static int g_window_w = 0;
 static int g_window_h = 0;
 static int g_tile_render_size = TILE_SIZE;
+static double g_tick_alpha = 1.0; // 시뮬레이션 틱 보간 비율 (0~1)
 
 #define HUD_FONT_WIDTH 5
 #define HUD_FONT_HEIGHT 7
@@ -192,48 +227,128 @@ static const char *kProfessorLabelFontCandidates[] = {
 };
 
 static char g_professor_label_texts[PROFESSOR_TEXTURE_COUNT][PROFESSOR_LABEL_TEXT_MAX];
-static SDL_Texture *g_professor_label_textures[PROFESSOR_TEXTURE_COUNT] = {NULL};
-static int g_professor_label_width[PROFESSOR_TEXTURE_COUNT] = {0};
-static int g_professor_label_height[PROFESSOR_TEXTURE_COUNT] = {0};
 static TTF_Font *g_professor_label_font = NULL;
 static char g_professor_label_font_path[512] = {0};
 static TTF_Font *g_ui_font_large = NULL;
 static TTF_Font *g_ui_font_small = NULL;
+// 폰트별 글리프 아틀라스 (모든 TTF 글자는 여기서 쿼드로 그림)
+static GlyphAtlas *g_label_atlas = NULL;    // 교수 이름표
+static GlyphAtlas *g_ui_large_atlas = NULL; // 메뉴, 제목, 기록
+static GlyphAtlas *g_ui_small_atlas = NULL; // 안내 문구, 성능 오버레이
 static int g_ttf_initialized = 0;
+static int g_vsync_requested = 1;
+static int g_vsync_active = 0;
+static int g_last_frame_draw_calls = 0;
+static int g_last_dirty_rects = 0;
+static long g_last_dirty_pixels = 0;
+static int g_capture_w = 0; // 녹화 슬롯 한 줄 픽셀 수 (render_start_capture)
+
+// 녹화 차례면 완성된 화면을 링 슬롯으로 읽어 옴 (YUV 변환/파일 쓰기는 인코더 스레드)
+// SDL2에는 비동기 읽기가 없어 이 복사 한 번은 렌더 스레드가 부담함
+static void capture_current_frame(void)
+{
+    void *pixels = capture_begin_frame();
+    if (!pixels)
+    {
+        return;
+    }
+    uint64_t trace_readback = trace_begin();
+    int ok = SDL_RenderReadPixels(g_renderer, NULL, SDL_PIXELFORMAT_ARGB8888, pixels, g_capture_w * 4) == 0;
+    trace_end("capture readback", "render", trace_readback);
+    capture_end_frame(ok);
+}
 
-typedef struct
+// 화면 표시 (vsync 대기 시간이 타임라인에 보이도록 트레이스 구간으로 감쌈)
+static void present_frame(void)
 {
-    SDL_Texture *texture;
-    int width;
-    int height;
-} StaticTexture;
+    g_last_frame_draw_calls = g_draw_calls_this_frame;
+    g_draw_calls_this_frame = 0;
 
-typedef struct
+    capture_current_frame(); // 표시 후에는 백 버퍼 내용이 정해져 있지 않으므로 그 전에 읽음
+
+    uint64_t trace_present = trace_begin();
+    SDL_RenderPresent(g_renderer);
+    trace_end("SDL_RenderPresent", "render", trace_present);
+
+    // 메뉴 화면 등이 창 표면 전체를 덮었으므로 다음 게임 프레임은 전체를 다시 그려야 함
+    dirty_rect_invalidate(g_dirty);
+}
+
+// render()가 기록한 호출 중 직전 프레임과 달라진 영역만 다시 그려 창에 올림
+static void present_dirty_frame(void)
 {
-    SDL_Texture *normal;
-    SDL_Texture *highlight;
-    int width;
-    int height;
-    const char *label;
-} MenuOptionTexture;
+    g_dirty_recording = 0;
+    g_last_frame_draw_calls = g_draw_calls_this_frame;
+    g_draw_calls_this_frame = 0;
+
+    uint64_t trace_present = trace_begin();
+    int rects = dirty_rect_present(g_dirty, g_renderer, g_window, &g_last_dirty_pixels);
+    g_last_dirty_rects = (rects > 0) ? rects : 0;
+    trace_end("dirty rect present", "render", trace_present);
+
+    capture_current_frame(); // 창 표면에 전체 화면이 남아 있으므로 올린 뒤에 읽음
+}
+
+static int dirty_rect_window_event_watch(void *userdata, SDL_Event *event)
+{
+    (void)userdata;
+    if (event->type == SDL_WINDOWEVENT &&
+        (event->window.event == SDL_WINDOWEVENT_EXPOSED ||
+         event->window.event == SDL_WINDOWEVENT_SIZE_CHANGED ||
+         event->window.event == SDL_WINDOWEVENT_RESTORED))
+    {
+        dirty_rect_invalidate(g_dirty);
+    }
+    return 0;
+}
+
+static const char *const kTitleMenuLabels[] = {"시작하기", "기록보기", "종료하기"};
+static const char *const kTitleHintText = "W/S 또는 ↑/↓ 로 이동, Enter로 선택";
+static const char *const kRecordsHintText = "아무 키나 누르면 돌아갑니다";
+static const char *const kGameOverHintText = "아무 키나 누르면 시작화면으로";
+
+// F3 성능 오버레이
+#define PERF_FRAME_HISTORY 120
+#define PERF_OVERLAY_LINES 9
+#define PERF_TEXT_REFRESH_MS 250
 
 typedef struct
 {
-    SDL_Texture *texture;
-    int width;
-    int height;
-    SDL_Color color;
-    char last_text[128];
-    int valid;
-} CachedText;
-
-static MenuOptionTexture g_title_menu_options[3];
-static StaticTexture g_title_hint_texture = {NULL, 0, 0};
-static CachedText g_title_logo_cache = {NULL, 0, 0, {0, 0, 0, 0}, "", 0};
-static CachedText g_records_best_cache = {NULL, 0, 0, {0, 0, 0, 0}, "", 0};
-static StaticTexture g_records_hint_texture = {NULL, 0, 0};
-static CachedText g_game_over_title_cache = {NULL, 0, 0, {0, 0, 0, 0}, "", 0};
-static StaticTexture g_game_over_hint_texture = {NULL, 0, 0};
+    int obstacles;
+    int clones;
+    int items;
+    int projectiles;
+    int bullets;
+} VisibleEntityCounts;
+
+static int g_perf_overlay_enabled = 0;
+static RenderPerfStats g_perf_stats = {0};
+static VisibleEntityCounts g_visible_counts = {0};
+static float g_frame_ms_history[PERF_FRAME_HISTORY];
+static int g_frame_ms_next = 0;
+static int g_frame_ms_count = 0;
+static Uint64 g_last_frame_counter = 0;
+static Uint32 g_perf_text_refreshed_at = 0;
+static char g_perf_text_lines[PERF_OVERLAY_LINES][128];
+
+// 동적 해상도: 프레임 시간이 예산을 넘으면 장면만 낮은 해상도 타깃에 그린 뒤 최근접 필터로 확대
+// - HUD/오버레이는 확대 후 원래 해상도로 그림
+// - 소프트웨어(더티 사각형) 경로에서는 쓰지 않음
+#define DYNRES_LEVEL_COUNT 3
+#define DYNRES_WINDOW 60           // 판단에 쓰는 최근 프레임 수 (바꾼 뒤에도 이만큼은 유지)
+#define DYNRES_DOWN_RATIO 1.15     // 평균이 예산의 115%를 넘으면 한 단계 낮춤
+#define DYNRES_UP_RATIO 1.03       // 예산 안에서 충분히 버티면 한 단계 올려 봄
+#define DYNRES_UP_STABLE_MIN 180   // 올리기 전 최소 안정 프레임 수
+#define DYNRES_UP_STABLE_MAX 1800  // 올렸다가 바로 다시 내려가면 두 배씩 늘려 진동 방지
+
+static const float kDynResScales[DYNRES_LEVEL_COUNT] = {1.0f, 0.75f, 0.5f};
+static double g_frame_budget_ms = 1000.0 / 60.0; // 프레임 페이서 목표 주기 (render_set_frame_budget_ms)
+static int g_dynres_enabled = 1;
+static int g_dynres_level = 0;
+static int g_dynres_frames_since_change = 0;
+static int g_dynres_up_stable_frames = DYNRES_UP_STABLE_MIN;
+static int g_dynres_last_change_was_up = 0;
+static SDL_Texture *g_scene_target = NULL; // WINDOW_WIDTH x WINDOW_HEIGHT, 왼쪽 위 일부만 사용
 
 static const HudFontGlyph *find_hud_glyph(char c)
 {
@@ -302,236 +417,6 @@ static void remember_professor_font_path(const char *path)
     g_professor_label_font_path[sizeof(g_professor_label_font_path) - 1] = '\0';
 }
 
-static SDL_Texture *create_text_texture(TTF_Font *font, const char *text, SDL_Color color, int *out_w, int *out_h)
-{
-    if (!font || !text)
-    {
-        return NULL;
-    }
-
-    SDL_Surface *surface = TTF_RenderUTF8_Blended(font, text, color);
-    if (!surface)
-    {
-        fprintf(stderr, "TTF_RenderUTF8_Blended failed for '%s': %s\n", text, TTF_GetError());
-        return NULL;
-    }
-
-    SDL_Texture *texture = SDL_CreateTextureFromSurface(g_renderer, surface);
-    if (!texture)
-    {
-        fprintf(stderr, "SDL_CreateTextureFromSurface failed for '%s': %s\n", text, SDL_GetError());
-        SDL_FreeSurface(surface);
-        return NULL;
-    }
-
-    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
-    if (out_w)
-    {
-        *out_w = surface->w;
-    }
-    if (out_h)
-    {
-        *out_h = surface->h;
-    }
-    SDL_FreeSurface(surface);
-    return texture;
-}
-
-static void destroy_static_texture(StaticTexture *target)
-{
-    if (!target)
-    {
-        return;
-    }
-    if (target->texture)
-    {
-        SDL_DestroyTexture(target->texture);
-    }
-    target->texture = NULL;
-    target->width = 0;
-    target->height = 0;
-}
-
-static void destroy_menu_option(MenuOptionTexture *option)
-{
-    if (!option)
-    {
-        return;
-    }
-    if (option->normal)
-    {
-        SDL_DestroyTexture(option->normal);
-    }
-    if (option->highlight)
-    {
-        SDL_DestroyTexture(option->highlight);
-    }
-    option->normal = NULL;
-    option->highlight = NULL;
-    option->width = 0;
-    option->height = 0;
-}
-
-static void destroy_cached_text(CachedText *cache)
-{
-    if (!cache)
-    {
-        return;
-    }
-    if (cache->texture)
-    {
-        SDL_DestroyTexture(cache->texture);
-    }
-    cache->texture = NULL;
-    cache->width = 0;
-    cache->height = 0;
-    cache->color = (SDL_Color){0, 0, 0, 0};
-    cache->last_text[0] = '\0';
-    cache->valid = 0;
-}
-
-static int cached_text_matches(const CachedText *cache, const char *text, SDL_Color color)
-{
-    if (!cache || !cache->valid)
-    {
-        return 0;
-    }
-    if (!text)
-    {
-        return 0;
-    }
-    if (cache->color.r != color.r || cache->color.g != color.g ||
-        cache->color.b != color.b || cache->color.a != color.a)
-    {
-        return 0;
-    }
-    return strncmp(cache->last_text, text, sizeof(cache->last_text)) == 0;
-}
-
-static void update_cached_text(CachedText *cache, TTF_Font *font, const char *text, SDL_Color color)
-{
-    if (!cache || !font || !text)
-    {
-        return;
-    }
-
-    if (cached_text_matches(cache, text, color))
-    {
-        return;
-    }
-
-    SDL_Texture *texture = create_text_texture(font, text, color, &cache->width, &cache->height);
-    if (!texture)
-    {
-        return;
-    }
-
-    if (cache->texture)
-    {
-        SDL_DestroyTexture(cache->texture);
-    }
-    cache->texture = texture;
-    cache->color = color;
-    strncpy(cache->last_text, text, sizeof(cache->last_text) - 1);
-    cache->last_text[sizeof(cache->last_text) - 1] = '\0';
-    cache->valid = 1;
-}
-
-static int build_title_menu_textures(void)
-{
-    if (!g_ui_font_large)
-    {
-        return -1;
-    }
-
-    const char *labels[] = {"시작하기", "기록보기", "종료하기"};
-    SDL_Color normal_color = {200, 200, 200, 255};
-    SDL_Color highlight_color = {255, 255, 255, 255};
-
-    for (int i = 0; i < ARRAY_LEN(g_title_menu_options); ++i)
-    {
-        destroy_menu_option(&g_title_menu_options[i]);
-        g_title_menu_options[i].label = labels[i];
-
-        int normal_w = 0;
-        int normal_h = 0;
-        int highlight_w = 0;
-        int highlight_h = 0;
-
-        g_title_menu_options[i].normal = create_text_texture(g_ui_font_large,
-                                                             labels[i],
-                                                             normal_color,
-                                                             &normal_w,
-                                                             &normal_h);
-        g_title_menu_options[i].highlight = create_text_texture(g_ui_font_large,
-                                                                labels[i],
-                                                                highlight_color,
-                                                                &highlight_w,
-                                                                &highlight_h);
-        if (!g_title_menu_options[i].normal || !g_title_menu_options[i].highlight)
-        {
-            return -1;
-        }
-
-        g_title_menu_options[i].width = (normal_w > highlight_w) ? normal_w : highlight_w;
-        g_title_menu_options[i].height = (normal_h > highlight_h) ? normal_h : highlight_h;
-    }
-    return 0;
-}
-
-static int build_static_textures(void)
-{
-    if (!g_ui_font_small)
-    {
-        return -1;
-    }
-
-    destroy_static_texture(&g_title_hint_texture);
-    destroy_static_texture(&g_records_hint_texture);
-    destroy_static_texture(&g_game_over_hint_texture);
-
-    SDL_Color hint_color = {180, 180, 180, 255};
-    g_title_hint_texture.texture = create_text_texture(g_ui_font_small,
-                                                       "W/S 또는 ↑/↓ 로 이동, Enter로 선택",
-                                                       hint_color,
-                                                       &g_title_hint_texture.width,
-                                                       &g_title_hint_texture.height);
-    g_records_hint_texture.texture = create_text_texture(g_ui_font_small,
-                                                         "아무 키나 누르면 돌아갑니다",
-                                                         hint_color,
-                                                         &g_records_hint_texture.width,
-                                                         &g_records_hint_texture.height);
-    g_game_over_hint_texture.texture = create_text_texture(g_ui_font_small,
-                                                           "아무 키나 누르면 시작화면으로",
-                                                           hint_color,
-                                                           &g_game_over_hint_texture.width,
-                                                           &g_game_over_hint_texture.height);
-
-    if (!g_title_hint_texture.texture || !g_records_hint_texture.texture || !g_game_over_hint_texture.texture)
-    {
-        return -1;
-    }
-    return 0;
-}
-
-static void destroy_title_screen_artifacts(void)
-{
-    for (int i = 0; i < ARRAY_LEN(g_title_menu_options); ++i)
-    {
-        destroy_menu_option(&g_title_menu_options[i]);
-    }
-    destroy_static_texture(&g_title_hint_texture);
-    destroy_cached_text(&g_title_logo_cache);
-}
-
-static void destroy_overlay_textures(void)
-{
-    destroy_static_texture(&g_records_hint_texture);
-    destroy_static_texture(&g_game_over_hint_texture);
-    destroy_cached_text(&g_records_best_cache);
-    destroy_cached_text(&g_game_over_title_cache);
-}
-
 static TTF_Font *open_professor_label_font(void)
 {
     const char *override_path = getenv("PROFESSOR_LABEL_FONT");
@@ -591,86 +476,130 @@ static TTF_Font *get_large_ui_font(void)
     return g_ui_font_large ? g_ui_font_large : g_professor_label_font;
 }
 
-/*  사용 안되는 함수 주석처리.
 static TTF_Font *get_small_ui_font(void)
 {
     return g_ui_font_small ? g_ui_font_small : g_professor_label_font;
 }
-*/
 
-static void destroy_professor_label_texture(int index)
+static int create_text_atlases(void)
 {
-    if (index < 0 || index >= PROFESSOR_TEXTURE_COUNT)
+    g_label_atlas = glyph_atlas_create(g_renderer, g_professor_label_font);
+    g_ui_large_atlas = glyph_atlas_create(g_renderer, get_large_ui_font());
+    g_ui_small_atlas = glyph_atlas_create(g_renderer, get_small_ui_font());
+    if (!g_label_atlas || !g_ui_large_atlas || !g_ui_small_atlas)
     {
-        return;
+        fprintf(stderr, "Glyph atlas creation failed\n");
+        return -1;
     }
-    if (g_professor_label_textures[index])
+
+    // 첫 화면에 쓰는 글자와 숫자/영문은 미리 래스터화 (기록/오버레이 숫자가 바뀌어도 새로 그릴 글자가 없음)
+    char ascii[96];
+    for (int c = 32; c < 127; ++c)
     {
-        SDL_DestroyTexture(g_professor_label_textures[index]);
-        g_professor_label_textures[index] = NULL;
+        ascii[c - 32] = (char)c;
     }
-    g_professor_label_width[index] = 0;
-    g_professor_label_height[index] = 0;
-}
+    ascii[95] = '\0';
 
-static void rebuild_professor_label_texture(int index)
-{
-    if (index < 0 || index >= PROFESSOR_TEXTURE_COUNT)
+    for (int i = 0; i < ARRAY_LEN(kTitleMenuLabels); ++i)
     {
-        return;
+        glyph_atlas_warm(g_ui_large_atlas, kTitleMenuLabels[i]);
     }
+    glyph_atlas_warm(g_ui_large_atlas, "교수님 피하기 재수강 최고 기록 없음");
+    glyph_atlas_warm(g_ui_large_atlas, ascii);
+    glyph_atlas_warm(g_ui_small_atlas, kTitleHintText);
+    glyph_atlas_warm(g_ui_small_atlas, kRecordsHintText);
+    glyph_atlas_warm(g_ui_small_atlas, kGameOverHintText);
+    glyph_atlas_warm(g_ui_small_atlas, ascii);
+    return 0;
+}
 
-    destroy_professor_label_texture(index);
+static void destroy_text_atlases(void)
+{
+    glyph_atlas_destroy(g_label_atlas);
+    glyph_atlas_destroy(g_ui_large_atlas);
+    glyph_atlas_destroy(g_ui_small_atlas);
+    g_label_atlas = NULL;
+    g_ui_large_atlas = NULL;
+    g_ui_small_atlas = NULL;
+}
 
-    if (!g_professor_label_font || !g_renderer)
-    {
-        return;
-    }
-    if (g_professor_label_texts[index][0] == '\0')
-    {
-        return;
-    }
+#define TEXT_MAX_QUADS 128
 
-    SDL_Color color = {245, 245, 245, 255};
-    SDL_Surface *surface = TTF_RenderUTF8_Blended(g_professor_label_font,
-                                                  g_professor_label_texts[index],
-                                                  color);
-    if (!surface)
-    {
-        fprintf(stderr, "TTF_RenderUTF8_Blended failed for label %d: %s\n", index, TTF_GetError());
-        return;
-    }
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+// 같은 페이지의 쿼드를 모아 페이지마다 SDL_RenderGeometry 한 번
+static void draw_glyph_quads_batched(const GlyphQuad *quads, int count, SDL_Color color)
+{
+    SDL_Vertex vertices[TEXT_MAX_QUADS * 4];
+    int indices[TEXT_MAX_QUADS * 6];
+    const float inv_page = 1.0f / (float)GLYPH_ATLAS_PAGE_SIZE;
+    unsigned char drawn[TEXT_MAX_QUADS] = {0};
 
-    SDL_Texture *texture = SDL_CreateTextureFromSurface(g_renderer, surface);
-    if (!texture)
+    for (int first = 0; first < count; ++first)
     {
-        fprintf(stderr, "SDL_CreateTextureFromSurface failed for label %d: %s\n", index, SDL_GetError());
-        SDL_FreeSurface(surface);
-        return;
+        if (drawn[first])
+        {
+            continue;
+        }
+        SDL_Texture *page = quads[first].texture;
+        int vertex_count = 0;
+        int index_count = 0;
+        for (int i = first; i < count; ++i)
+        {
+            if (drawn[i] || quads[i].texture != page)
+            {
+                continue;
+            }
+            drawn[i] = 1;
+
+            const SDL_Rect *src = &quads[i].src;
+            const SDL_Rect *dst = &quads[i].dst;
+            const float x0 = (float)dst->x, y0 = (float)dst->y;
+            const float x1 = (float)(dst->x + dst->w), y1 = (float)(dst->y + dst->h);
+            const float u0 = src->x * inv_page, v0 = src->y * inv_page;
+            const float u1 = (src->x + src->w) * inv_page, v1 = (src->y + src->h) * inv_page;
+            SDL_Vertex *v = &vertices[vertex_count];
+            v[0] = (SDL_Vertex){{x0, y0}, color, {u0, v0}};
+            v[1] = (SDL_Vertex){{x1, y0}, color, {u1, v0}};
+            v[2] = (SDL_Vertex){{x1, y1}, color, {u1, v1}};
+            v[3] = (SDL_Vertex){{x0, y1}, color, {u0, v1}};
+            const int quad_indices[6] = {0, 1, 2, 0, 2, 3};
+            for (int k = 0; k < 6; ++k)
+            {
+                indices[index_count++] = vertex_count + quad_indices[k];
+            }
+            vertex_count += 4;
+        }
+        SDL_SetTextureColorMod(page, 255, 255, 255);
+        SDL_SetTextureAlphaMod(page, 255);
+        SDL_RenderGeometry(g_renderer, page, vertices, vertex_count, indices, index_count);
     }
-
-    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
-    g_professor_label_width[index] = surface->w;
-    g_professor_label_height[index] = surface->h;
-    SDL_FreeSurface(surface);
-    g_professor_label_textures[index] = texture;
 }
+#endif
 
-/* 사용안되는 함수 주석처리.
-static void rebuild_all_professor_label_textures(void)
+// 아틀라스 글자로 문자열 그리기 (x, y: 왼쪽 위, scale: 정수 배율)
+static void draw_atlas_text(GlyphAtlas *atlas, const char *text, int x, int y, int scale, SDL_Color color)
 {
-    for (int i = 0; i < PROFESSOR_TEXTURE_COUNT; ++i)
+    GlyphQuad quads[TEXT_MAX_QUADS];
+    int count = glyph_atlas_layout(atlas, text, 0, 0, quads, TEXT_MAX_QUADS, NULL);
+    for (int i = 0; i < count; ++i)
     {
-        rebuild_professor_label_texture(i);
+        SDL_Rect *dst = &quads[i].dst;
+        *dst = (SDL_Rect){x + dst->x * scale, y + dst->y * scale, dst->w * scale, dst->h * scale};
     }
-}
-*/
 
-static void destroy_all_professor_label_textures(void)
-{
-    for (int i = 0; i < PROFESSOR_TEXTURE_COUNT; ++i)
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (!g_dirty_recording)
     {
-        destroy_professor_label_texture(i);
+        draw_glyph_quads_batched(quads, count, color);
+        return;
+    }
+#endif
+    // SDL 2.0.18 미만이거나 더티 사각형 기록 중이면 쿼드마다 색 변조 + 복사
+    for (int i = 0; i < count; ++i)
+    {
+        SDL_SetTextureColorMod(quads[i].texture, color.r, color.g, color.b);
+        SDL_SetTextureAlphaMod(quads[i].texture, color.a);
+        SDL_RenderCopy(g_renderer, quads[i].texture, &quads[i].src, &quads[i].dst);
     }
 }
 
@@ -711,10 +640,7 @@ static void cache_professor_label_text(int index, const char *texture_path)
                                       g_professor_label_texts[index],
                                       sizeof(g_professor_label_texts[index]));
 
-    if (g_professor_label_font && g_renderer)
-    {
-        rebuild_professor_label_texture(index);
-    }
+    glyph_atlas_warm(g_label_atlas, g_professor_label_texts[index]);
 }
 
 static int get_professor_label_index_for_stage(int stage_identifier)
@@ -758,89 +684,19 @@ static void update_tile_render_metrics(void)
     g_tile_render_size = selected;
 }
 
-static int is_tile_blocking_vision(const Stage *stage, int x, int y)
-{
-    if (!stage)
-        return 1;
-
-    int width = (stage->width > 0) ? stage->width : MAX_X;
-    int height = (stage->height > 0) ? stage->height : MAX_Y;
-    if (x < 0 || y < 0 || x >= width || y >= height)
-        return 1;
-
-    char cell = stage->map[y][x];
-    return (cell == '#' || cell == '@');
-}
-
-static int has_line_of_sight(const Stage *stage, int start_x, int start_y, int target_x, int target_y)
-{
-    if (!stage)
-        return 0;
-
-    int width = (stage->width > 0) ? stage->width : MAX_X;
-    int height = (stage->height > 0) ? stage->height : MAX_Y;
-    if (target_x < 0 || target_y < 0 || target_x >= width || target_y >= height)
-        return 0;
-
-    int x0 = start_x;
-    int y0 = start_y;
-    int x1 = target_x;
-    int y1 = target_y;
-    int dx = abs(x1 - x0);
-    int sx = (x0 < x1) ? 1 : -1;
-    int dy = -abs(y1 - y0);
-    int sy = (y0 < y1) ? 1 : -1;
-    int err = dx + dy;
-
-    while (1)
-    {
-        if (!(x0 == start_x && y0 == start_y) && (x0 != x1 || y0 != y1))
-        {
-            if (is_tile_blocking_vision(stage, x0, y0))
-            {
-                return 0;
-            }
-        }
-
-        if (x0 == x1 && y0 == y1)
-        {
-            break;
-        }
-
-        int e2 = 2 * err;
-        if (e2 >= dy)
-        {
-            err += dy;
-            x0 += sx;
-        }
-        if (e2 <= dx)
-        {
-            err += dx;
-            y0 += sy;
-        }
-    }
-
-    return 1;
-}
-
+// 플레이어 칸에서 보이는 타일 표시 (스테이지 로드 때 미리 계산한 PVS 비트 행을 펼침)
 static void compute_visibility(const Stage *stage, const Player *player, unsigned char visibility[MAX_Y][MAX_X])
 {
-    int width = (stage && stage->width > 0) ? stage->width : MAX_X;
-    int height = (stage && stage->height > 0) ? stage->height : MAX_Y;
-
-    for (int y = 0; y < height; ++y)
-    {
-        for (int x = 0; x < width; ++x)
-        {
-            visibility[y][x] = 0;
-        }
-    }
+    memset(visibility, 0, sizeof(unsigned char) * MAX_Y * MAX_X);
 
     if (!stage || !player)
     {
         return;
     }
 
+    int width = (stage->width > 0) ? stage->width : MAX_X;
+    int height = (stage->height > 0) ? stage->height : MAX_Y;
+
     int start_x = player->world_x / SUBPIXELS_PER_TILE;
     int start_y = player->world_y / SUBPIXELS_PER_TILE;
     if (start_x < 0)
@@ -852,13 +708,14 @@ static void compute_visibility(const Stage *stage, const Player *player, unsigne
     if (start_y >= height)
         start_y = height - 1;
 
-    for (int y = 0; y < height; ++y)
+    if (!stage->pvs)
     {
-        for (int x = 0; x < width; ++x)
-        {
-            visibility[y][x] = has_line_of_sight(stage, start_x, start_y, x, y);
-        }
+        // PVS 생성 실패 시 시야 제한 없이 그림
+        memset(visibility, 1, sizeof(unsigned char) * MAX_Y * MAX_X);
+        return;
     }
+
+    pvs_fill_visibility(stage->pvs, start_x, start_y, visibility);
 }
 
 static void compute_camera(const Stage *stage, const Player *player, Camera *camera)
@@ -920,32 +777,203 @@ static void compute_camera(const Stage *stage, const Player *player, Camera *cam
     camera->tile_end_y = (int)ceil((camera->pixel_y + viewport_h) / tile_size) + CAMERA_TILE_PADDING;
 }
 
-static SDL_Texture *load_texture(const char *path)
+static void destroy_texture(SDL_Texture **texture)
 {
-    SDL_Surface *surface = IMG_Load(path);
-    if (!surface)
+    if (texture && *texture)
     {
-        fprintf(stderr, "IMG_Load failed for %s: %s\n", path, IMG_GetError());
-        return NULL;
+        SDL_DestroyTexture(*texture);
+        *texture = NULL;
     }
+}
 
-    SDL_Texture *texture = SDL_CreateTextureFromSurface(g_renderer, surface);
-    SDL_FreeSurface(surface);
+// 비동기 텍스처 로딩
+// - init_renderer는 디코딩 작업만 넣고 바로 돌아가서 타이틀 화면을 먼저 띄움
+// - 끝난 디코딩은 render_pump_assets(메뉴 대기 루프)가 텍스처로 만들고, 게임 시작 전 render_finish_assets가 나머지를 기다림
+// - 모든 칸은 texture_cache를 거치므로 같은 파일을 가리키는 칸은 텍스처 하나를 공유 (해제도 캐시로)
+#define MAX_TEXTURE_LOADS 96
 
-    if (!texture)
+typedef struct
+{
+    SDL_Texture **slot;
+    const char *path; // 문자열 리터럴/정적 표 (복사하지 않음)
+    int entry;        // texture_cache 항목
+    int done;         // *slot에 결과를 넣었는지
+    int required;     // 없으면 게임을 시작할 수 없음
+} TextureLoad;
+
+static TextureLoad g_texture_loads[MAX_TEXTURE_LOADS];
+static int g_texture_load_count = 0;
+static int g_texture_loads_pending = 0;
+static int g_texture_loads_checked = 0; // render_finish_assets 결과 (0: 아직, 1: 성공, -1: 실패)
+
+// 교수 초상화는 스테이지 시작 직전에만 로드 (render_prepare_stage)
+#define PROFESSOR_PORTRAIT_COUNT 6
+static SDL_Texture **const kProfessorTextures[PROFESSOR_PORTRAIT_COUNT] = {
+    &g_tex_professor_1, &g_tex_professor_2, &g_tex_professor_3,
+    &g_tex_professor_4, &g_tex_professor_5, &g_tex_professor_6};
+static const char *const kProfessorPortraitPaths[PROFESSOR_PORTRAIT_COUNT] = {
+    "assets/image/김명석교수님.png",
+    "assets/image/이종택교수님.png",
+    "assets/image/김진욱교수님.png",
+    "assets/image/김명옥교수님.png",
+    "assets/image/김정근교수님.png",
+    "assets/image/한명균교수님.png"};
+static int g_professor_entries[PROFESSOR_PORTRAIT_COUNT] = {-1, -1, -1, -1, -1, -1}; // 잡고 있는 캐시 항목
+
+static void queue_texture(SDL_Texture **slot, const char *path, int required)
+{
+    if (g_texture_load_count >= MAX_TEXTURE_LOADS)
     {
-        fprintf(stderr, "SDL_CreateTextureFromSurface failed for %s: %s\n", path, SDL_GetError());
+        fprintf(stderr, "Texture load table full, skipping %s\n", path);
+        return;
     }
 
-    return texture;
+    TextureLoad *load = &g_texture_loads[g_texture_load_count++];
+    load->slot = slot;
+    load->path = path;
+    load->required = required;
+    load->entry = texture_cache_request(path);
+    load->done = !texture_cache_pending(load->entry);
+    if (load->done)
+    {
+        *slot = texture_cache_texture(load->entry);
+    }
+    else
+    {
+        g_texture_loads_pending++;
+    }
 }
 
-static void destroy_texture(SDL_Texture **texture)
+// 캐시 항목이 끝난 칸에 텍스처를 채움. 채운 칸 수 반환
+static int fill_finished_texture_loads(void)
 {
-    if (texture && *texture)
+    int filled = 0;
+    for (int i = 0; i < g_texture_load_count && g_texture_loads_pending > 0; ++i)
     {
-        SDL_DestroyTexture(*texture);
-        *texture = NULL;
+        TextureLoad *load = &g_texture_loads[i];
+        if (!load->done && !texture_cache_pending(load->entry))
+        {
+            *load->slot = texture_cache_texture(load->entry);
+            load->done = 1;
+            g_texture_loads_pending--;
+            filled++;
+        }
+    }
+    return filled;
+}
+
+int render_pump_assets(void)
+{
+    if (g_texture_loads_pending == 0)
+    {
+        return 0;
+    }
+    texture_cache_pump();
+    return fill_finished_texture_loads();
+}
+
+int render_assets_pending(void)
+{
+    return g_texture_loads_pending;
+}
+
+static void report_texture_cache_stats(void)
+{
+    TextureCacheStats stats;
+    texture_cache_get_stats(&stats);
+    int pixel_hits = 0;
+    int pixel_misses = 0;
+    pixel_cache_get_stats(&pixel_hits, &pixel_misses);
+    printf("텍스처 캐시: 요청 %d개, 고유 파일 %d개, 텍스처 메모리 %.1f KiB, 픽셀 캐시 적중 %d / 미적중 %d\n",
+           stats.requested, stats.unique, (double)stats.texture_bytes / 1024.0, pixel_hits, pixel_misses);
+}
+
+int render_finish_assets(void)
+{
+    if (g_texture_loads_checked != 0)
+    {
+        return g_texture_loads_checked > 0 ? 0 : -1;
+    }
+
+    uint64_t trace_wait = trace_begin();
+    for (int i = 0; i < g_texture_load_count; ++i)
+    {
+        if (!g_texture_loads[i].done)
+        {
+            texture_cache_wait(g_texture_loads[i].entry);
+        }
+    }
+    fill_finished_texture_loads();
+    trace_end("finish assets", "asset", trace_wait);
+
+    g_texture_loads_checked = 1;
+    for (int i = 0; i < g_texture_load_count; ++i)
+    {
+        if (g_texture_loads[i].required && !*g_texture_loads[i].slot)
+        {
+            fprintf(stderr, "Required texture missing: %s\n", g_texture_loads[i].path);
+            g_texture_loads_checked = -1;
+        }
+    }
+    report_texture_cache_stats();
+    return g_texture_loads_checked > 0 ? 0 : -1;
+}
+
+static void release_texture_loads(void)
+{
+    for (int i = 0; i < g_texture_load_count; ++i)
+    {
+        texture_cache_release(g_texture_loads[i].entry);
+        *g_texture_loads[i].slot = NULL;
+    }
+    g_texture_load_count = 0;
+    g_texture_loads_pending = 0;
+    g_texture_loads_checked = 0;
+}
+
+static void release_professor_portrait(int index)
+{
+    texture_cache_release(g_professor_entries[index]);
+    g_professor_entries[index] = -1;
+    *kProfessorTextures[index] = NULL;
+}
+
+static int professor_portrait_index_for_stage(int stage_id)
+{
+    // render()의 교수 텍스처 선택과 같은 규칙 (범위 밖이면 첫 번째 교수)
+    return (stage_id >= 1 && stage_id <= PROFESSOR_PORTRAIT_COUNT) ? stage_id - 1 : 0;
+}
+
+void render_prepare_stage(int stage_id)
+{
+    int current = professor_portrait_index_for_stage(stage_id);
+    int next = professor_portrait_index_for_stage(stage_id + 1);
+
+    // 이번/다음 스테이지가 아닌 교수 텍스처는 내려놓음
+    for (int i = 0; i < PROFESSOR_PORTRAIT_COUNT; ++i)
+    {
+        if (i != current && i != next)
+        {
+            release_professor_portrait(i);
+        }
+    }
+
+    if (g_professor_entries[current] < 0)
+    {
+        g_professor_entries[current] = texture_cache_request(kProfessorPortraitPaths[current]);
+    }
+    uint64_t trace_load = trace_begin();
+    *kProfessorTextures[current] = texture_cache_wait(g_professor_entries[current]);
+    trace_end("load professor", "asset", trace_load);
+    if (!*kProfessorTextures[current])
+    {
+        fprintf(stderr, "Professor portrait unavailable for stage %d\n", stage_id);
+    }
+
+    // 다음 스테이지 교수는 이번 스테이지를 하는 동안 디코딩해 둠 (텍스처는 그 스테이지 준비 때 받음)
+    if (next != current && g_professor_entries[next] < 0)
+    {
+        g_professor_entries[next] = texture_cache_request(kProfessorPortraitPaths[next]);
     }
 }
 
@@ -966,10 +994,11 @@ static void draw_professor_nameplate(int label_index, double world_x, double wor
         return;
     }
 
-    SDL_Texture *label_tex = g_professor_label_textures[label_index];
-    int text_w = g_professor_label_width[label_index];
-    int text_h = g_professor_label_height[label_index];
-    if (!label_tex || text_w <= 0 || text_h <= 0)
+    const char *label = g_professor_label_texts[label_index];
+    int text_w = 0;
+    int text_h = 0;
+    glyph_atlas_measure(g_label_atlas, label, &text_w, &text_h);
+    if (label[0] == '\0' || text_w <= 0 || text_h <= 0)
     {
         return;
     }
@@ -995,8 +1024,8 @@ static void draw_professor_nameplate(int label_index, double world_x, double wor
     SDL_SetRenderDrawColor(g_renderer, 10, 10, 10, 180);
     SDL_RenderFillRect(g_renderer, &background);
 
-    SDL_Rect dst = {label_x, label_y, text_w, text_h};
-    SDL_RenderCopy(g_renderer, label_tex, NULL, &dst);
+    SDL_Color label_color = {245, 245, 245, 255};
+    draw_atlas_text(g_label_atlas, label, label_x, label_y, 1, label_color);
     SDL_SetRenderDrawBlendMode(g_renderer, SDL_BLENDMODE_NONE);
 }
 
@@ -1059,6 +1088,30 @@ static void draw_texture_scaled(SDL_Texture *texture, double world_x, double wor
     SDL_RenderCopy(g_renderer, texture, NULL, &dst);
 }
 
+// 직전 틱과 현재 틱 위치(타일 단위)를 보간한다.
+// 순간이동/위치 교환처럼 한 틱에 1타일 넘게 움직였으면 끌리는 잔상이 생기지 않게 현재 위치를 그대로 쓴다.
+static void interpolate_tick_position(double prev_x, double prev_y, double cur_x, double cur_y,
+                                      double *out_x, double *out_y)
+{
+    if (fabs(cur_x - prev_x) > 1.0 || fabs(cur_y - prev_y) > 1.0)
+    {
+        *out_x = cur_x;
+        *out_y = cur_y;
+        return;
+    }
+    *out_x = prev_x + (cur_x - prev_x) * g_tick_alpha;
+    *out_y = prev_y + (cur_y - prev_y) * g_tick_alpha;
+}
+
+void render_set_tick_alpha(double alpha)
+{
+    if (alpha < 0.0)
+        alpha = 0.0;
+    if (alpha > 1.0)
+        alpha = 1.0;
+    g_tick_alpha = alpha;
+}
+
 static int compute_vertical_bounce_offset(double elapsed_time)
 {
     const double speed = 6.0;
@@ -1067,9 +1120,34 @@ static int compute_vertical_bounce_offset(double elapsed_time)
     return (int)lround(wave * amplitude);
 }
 
-int init_renderer(void)
+// 장면용 렌더 타깃 (확대할 때 최근접 필터를 쓰도록 생성 시점에만 힌트를 바꿈)
+static void create_scene_target(void)
+{
+    if (g_dirty || !g_renderer)
+    {
+        return;
+    }
+
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(g_renderer, &info) != 0 || !(info.flags & SDL_RENDERER_TARGETTEXTURE))
+    {
+        return;
+    }
+
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+    g_scene_target = SDL_CreateTexture(g_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                       WINDOW_WIDTH, WINDOW_HEIGHT);
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+    if (!g_scene_target)
+    {
+        fprintf(stderr, "Scene render target unavailable, dynamic resolution disabled: %s\n", SDL_GetError());
+    }
+}
+
+// SDL/SDL_image/SDL_ttf 초기화 (subsystems: SDL_Init에 넘길 서브시스템)
+static int init_sdl_libraries(Uint32 subsystems)
 {
-    if (SDL_Init(SDL_INIT_VIDEO) != 0)
+    if (SDL_Init(subsystems) != 0)
     {
         fprintf(stderr, "SDL_Init failed: %s\n", SDL_GetError());
         return -1;
@@ -1092,6 +1170,17 @@ int init_renderer(void)
     g_ttf_initialized = 1;
 
     SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+    return 0;
+}
+
+static int init_renderer_resources(void);
+
+int init_renderer(void)
+{
+    if (init_sdl_libraries(SDL_INIT_VIDEO) != 0)
+    {
+        return -1;
+    }
 
     const int initial_w = WINDOW_WIDTH;
     const int initial_h = WINDOW_HEIGHT;
@@ -1109,7 +1198,30 @@ int init_renderer(void)
         return -1;
     }
 
-    g_renderer = SDL_CreateRenderer(g_window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    // GPU가 없으면 소프트웨어 렌더러 + 더티 사각형 출력 (GAME_SOFTWARE_RENDER=1이면 강제)
+    const char *force_software = getenv("GAME_SOFTWARE_RENDER");
+    int want_software = force_software && force_software[0] && strcmp(force_software, "0") != 0;
+    if (!want_software)
+    {
+        Uint32 renderer_flags = SDL_RENDERER_ACCELERATED | (g_vsync_requested ? SDL_RENDERER_PRESENTVSYNC : 0);
+        g_renderer = SDL_CreateRenderer(g_window, -1, renderer_flags);
+        if (!g_renderer)
+        {
+            fprintf(stderr, "Accelerated renderer unavailable (%s), using software renderer\n", SDL_GetError());
+        }
+    }
+    if (!g_renderer)
+    {
+        g_renderer = SDL_CreateRenderer(g_window, -1, SDL_RENDERER_SOFTWARE);
+        if (g_renderer)
+        {
+            g_dirty = dirty_rect_create(WINDOW_WIDTH, WINDOW_HEIGHT);
+            if (g_dirty)
+            {
+                SDL_AddEventWatch(dirty_rect_window_event_watch, NULL);
+            }
+        }
+    }
     if (!g_renderer)
     {
         fprintf(stderr, "SDL_CreateRenderer failed: %s\n", SDL_GetError());
@@ -1120,8 +1232,48 @@ int init_renderer(void)
         return -1;
     }
 
-    g_window_w = initial_w;
-    g_window_h = initial_h;
+    return init_renderer_resources();
+}
+
+int init_offscreen_renderer(void)
+{
+    // 소프트웨어 렌더러가 표면에 바로 그리므로 비디오 서브시스템(디스플레이)은 필요 없음
+    if (init_sdl_libraries(SDL_INIT_TIMER) != 0)
+    {
+        return -1;
+    }
+
+    g_offscreen_surface = SDL_CreateRGBSurfaceWithFormat(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (g_offscreen_surface)
+    {
+        g_renderer = SDL_CreateSoftwareRenderer(g_offscreen_surface);
+    }
+    if (!g_renderer)
+    {
+        fprintf(stderr, "Offscreen renderer creation failed: %s\n", SDL_GetError());
+        shutdown_renderer();
+        return -1;
+    }
+
+    return init_renderer_resources();
+}
+
+SDL_Surface *render_offscreen_surface(void)
+{
+    return g_offscreen_surface;
+}
+
+// 출력 대상(창 또는 표면)과 렌더러가 정해진 뒤 폰트/글리프 아틀라스를 만들고 텍스처 로딩 시작
+static int init_renderer_resources(void)
+{
+    g_window_w = WINDOW_WIDTH;
+    g_window_h = WINDOW_HEIGHT;
+
+    SDL_RendererInfo renderer_info;
+    g_vsync_active = (SDL_GetRendererInfo(g_renderer, &renderer_info) == 0 &&
+                      (renderer_info.flags & SDL_RENDERER_PRESENTVSYNC))
+                         ? 1
+                         : 0;
 
     SDL_RenderSetLogicalSize(g_renderer, WINDOW_WIDTH, WINDOW_HEIGHT);
 
@@ -1140,53 +1292,55 @@ int init_renderer(void)
         return -1;
     }
 
-    if (build_title_menu_textures() != 0 || build_static_textures() != 0)
+    if (create_text_atlases() != 0)
     {
         shutdown_renderer();
         return -1;
     }
 
     update_tile_render_metrics();
+    create_scene_target();
+
+    if (asset_loader_init(0) != 0)
+    {
+        fprintf(stderr, "Asset decode threads unavailable, decoding on the render thread\n");
+    }
+    texture_cache_init(g_renderer);
+
+    // 타이틀 배경을 먼저 디코딩하도록 맨 앞에 넣음
+    queue_texture(&g_tex_menu_background, "assets/image/menu.png", 1);
+
+    queue_texture(&g_tex_floor, "assets/image/floor64.png", 1);
+    queue_texture(&g_tex_wall, "assets/image/wall64.png", 1);
+    queue_texture(&g_tex_goal, "assets/image/backpack64.png", 1);
+    queue_texture(&g_tex_exit, "assets/image/exit.PNG", 1);
+
+    // 교수 초상화 텍스처는 render_prepare_stage에서 로드, 이름표만 미리 만들어 둠
+    for (int i = 0; i < PROFESSOR_PORTRAIT_COUNT; ++i)
+    {
+        cache_professor_label_text(i, kProfessorPortraitPaths[i]);
+    }
+
+    queue_texture(&g_tex_obstacle, "assets/image/professor64.png", 0); // X (일반)
+    queue_texture(&g_tex_spinner, "assets/image/professor64.png", 0);  // R (스피너)
+
+    queue_texture(&g_tex_item_shield, "assets/image/shield64.png", 1);   // I 아이템 전용 텍스처
+    queue_texture(&g_tex_item_scooter, "assets/image/scooter64.png", 1); // E 아이템 전용 텍스처
+    queue_texture(&g_tex_item_supply, "assets/image/supply.png", 0);     // A 아이템 투사체 보급
 
-    g_tex_floor = load_texture("assets/image/floor64.png");
-    g_tex_wall = load_texture("assets/image/wall64.png");
-    g_tex_goal = load_texture("assets/image/backpack64.png");
-    g_tex_exit = load_texture("assets/image/exit.PNG");
-
-    g_tex_professor_1 = load_texture("assets/image/김명석교수님.png");
-    cache_professor_label_text(0, "assets/image/김명석교수님.png");
-    g_tex_professor_2 = load_texture("assets/image/이종택교수님.png");
-    cache_professor_label_text(1, "assets/image/이종택교수님.png");
-    g_tex_professor_3 = load_texture("assets/image/김진욱교수님.png");
-    cache_professor_label_text(2, "assets/image/김진욱교수님.png");
-    g_tex_professor_4 = load_texture("assets/image/김명옥교수님.png");
-    cache_professor_label_text(3, "assets/image/김명옥교수님.png");
-    g_tex_professor_5 = load_texture("assets/image/김정근교수님.png");
-    cache_professor_label_text(4, "assets/image/김정근교수님.png");
-    g_tex_professor_6 = load_texture("assets/image/한명균교수님.png");
-    cache_professor_label_text(5, "assets/image/한명균교수님.png");
-
-    g_tex_obstacle = load_texture("assets/image/professor64.png"); // X (일반)
-    g_tex_spinner = load_texture("assets/image/professor64.png");  // R (스피너)
-
-    g_tex_item_shield = load_texture("assets/image/shield64.png");   // I 아이템 전용 텍스처
-    g_tex_item_scooter = load_texture("assets/image/scooter64.png"); // E 아이템 전용 텍스처
-    g_tex_item_supply = load_texture("assets/image/supply.png");     // A 아이템 투사체 보급
-
-    g_tex_student_w_left = load_texture("assets/image/w_left.png");
-    g_tex_student_w_right = load_texture("assets/image/w_right.PNG");
-    g_tex_student_m_left = load_texture("assets/image/m_left.png");
-    g_tex_student_m_right = load_texture("assets/image/m_right.png");
-
-    g_tex_pulpit = load_texture("assets/image/pulpit64.png");
-
-    g_tex_trap = load_texture("assets/image/floor64.png");         // 트랩 (일반타일로 의문사 또는 실제 보이게 해서 못 지나가도록)
-    g_tex_wall_break = load_texture("assets/image/wall64.png"); // 깨지는 벽
-
-    g_tex_projectile = load_texture("assets/image/ball.png");       // 플레이어 투사체
-    g_tex_professor_bullet = load_texture("assets/image/bullet.png"); // 교수 스킬 탄환
-    g_tex_shield_on = load_texture("assets/image/shieldon64.png");  // 보호막 활성화 표현
-    g_tex_menu_background = load_texture("assets/image/menu.png");
+    queue_texture(&g_tex_student_w_left, "assets/image/w_left.png", 1);
+    queue_texture(&g_tex_student_w_right, "assets/image/w_right.PNG", 1);
+    queue_texture(&g_tex_student_m_left, "assets/image/m_left.png", 1);
+    queue_texture(&g_tex_student_m_right, "assets/image/m_right.png", 1);
+
+    queue_texture(&g_tex_pulpit, "assets/image/pulpit64.png", 1);
+
+    queue_texture(&g_tex_trap, "assets/image/floor64.png", 0);      // 트랩 (일반타일로 의문사 또는 실제 보이게 해서 못 지나가도록)
+    queue_texture(&g_tex_wall_break, "assets/image/wall64.png", 0); // 깨지는 벽
+
+    queue_texture(&g_tex_projectile, "assets/image/ball.png", 1);         // 플레이어 투사체
+    queue_texture(&g_tex_professor_bullet, "assets/image/bullet.png", 1); // 교수 스킬 탄환
+    queue_texture(&g_tex_shield_on, "assets/image/shieldon64.png", 1);    // 보호막 활성화 표현
 
     const char *game_over_candidates[] = {
         "assets/image/gameover.png",
@@ -1204,17 +1358,12 @@ int init_renderer(void)
     }
     if (game_over_path)
     {
-        g_tex_game_over_image = load_texture(game_over_path);
+        queue_texture(&g_tex_game_over_image, game_over_path, 1);
     }
-
-    if (!g_tex_projectile || !g_tex_professor_bullet || !g_tex_item_shield || !g_tex_item_scooter || !g_tex_shield_on)
-        return -1;
-
-    if (!g_tex_floor || !g_tex_wall || !g_tex_goal || !g_tex_professor_1 || !g_tex_exit ||
-        !g_tex_student_w_left || !g_tex_student_w_right || !g_tex_student_m_left ||
-        !g_tex_student_m_right || !g_tex_pulpit || !g_tex_menu_background ||
-        !g_tex_game_over_image)
+    else
     {
+        fprintf(stderr, "Game over image not found\n");
+        shutdown_renderer();
         return -1;
     }
 
@@ -1230,11 +1379,7 @@ int init_renderer(void)
                 set->step_b};
             for (int frame = 0; frame < PLAYER_FRAME_COUNT; frame++)
             {
-                g_player_textures[variant][facing][frame] = load_texture(paths[frame]);
-                if (!g_player_textures[variant][facing][frame])
-                {
-                    return -1;
-                }
+                queue_texture(&g_player_textures[variant][facing][frame], paths[frame], 1);
             }
         }
     }
@@ -1242,11 +1387,44 @@ int init_renderer(void)
     return 0;
 }
 
+int render_start_capture(const char *path, int fps)
+{
+    int w = 0;
+    int h = 0;
+    if (!g_renderer || SDL_GetRendererOutputSize(g_renderer, &w, &h) != 0)
+    {
+        return -1;
+    }
+    if (capture_start(path, w, h, fps) != 0)
+    {
+        return -1;
+    }
+    g_capture_w = w;
+    return 0;
+}
+
 void shutdown_renderer(void)
 {
-    destroy_title_screen_artifacts();
-    destroy_overlay_textures();
-    destroy_all_professor_label_textures();
+    capture_stop();
+
+    // 이미지 텍스처는 모두 캐시 소유 (칸별로 따로 해제하지 않음)
+    release_texture_loads();
+    for (int i = 0; i < PROFESSOR_PORTRAIT_COUNT; ++i)
+    {
+        release_professor_portrait(i);
+    }
+    texture_cache_shutdown();
+    asset_loader_shutdown();
+
+    destroy_texture(&g_scene_target);
+    if (g_dirty)
+    {
+        SDL_DelEventWatch(dirty_rect_window_event_watch, NULL);
+        dirty_rect_destroy(g_dirty);
+        g_dirty = NULL;
+        g_dirty_recording = 0;
+    }
+    destroy_text_atlases();
     if (g_professor_label_font)
     {
         TTF_CloseFont(g_professor_label_font);
@@ -1263,51 +1441,6 @@ void shutdown_renderer(void)
         g_ui_font_small = NULL;
     }
 
-    destroy_texture(&g_tex_floor);
-    destroy_texture(&g_tex_wall);
-    destroy_texture(&g_tex_goal);
-    destroy_texture(&g_tex_exit);
-    destroy_texture(&g_tex_menu_background);
-    destroy_texture(&g_tex_game_over_image);
-
-    destroy_texture(&g_tex_professor_1); // 교수
-    destroy_texture(&g_tex_professor_2);
-    destroy_texture(&g_tex_professor_3);
-    destroy_texture(&g_tex_professor_4);
-    destroy_texture(&g_tex_professor_5);
-    destroy_texture(&g_tex_professor_6);
-
-    destroy_texture(&g_tex_obstacle);    // 일반 장애물
-    destroy_texture(&g_tex_spinner);     // 도는 장애물
-    destroy_texture(&g_tex_item_shield); // 아이템 렌더링 셧다운
-    destroy_texture(&g_tex_item_scooter);
-    destroy_texture(&g_tex_item_supply); // 보급
-
-    destroy_texture(&g_tex_wall_break); // 깨지는 벽
-
-    destroy_texture(&g_tex_trap); // 트랩
-
-    destroy_texture(&g_tex_projectile);        // 플레이어 투사체
-    destroy_texture(&g_tex_professor_bullet);  // 교수 탄환
-    destroy_texture(&g_tex_shield_on);  // 플레이어 보호막 텍스처
-    destroy_texture(&g_tex_student_w_left);
-    destroy_texture(&g_tex_student_w_right);
-    destroy_texture(&g_tex_student_m_left);
-    destroy_texture(&g_tex_student_m_right);
-
-    destroy_texture(&g_tex_pulpit);
-
-    for (int variant = 0; variant < PLAYER_VARIANT_COUNT; variant++)
-    {
-        for (int facing = 0; facing < PLAYER_FACING_COUNT; facing++)
-        {
-            for (int frame = 0; frame < PLAYER_FRAME_COUNT; frame++)
-            {
-                destroy_texture(&g_player_textures[variant][facing][frame]);
-            }
-        }
-    }
-
     if (g_renderer)
     {
         SDL_DestroyRenderer(g_renderer);
@@ -1318,6 +1451,11 @@ void shutdown_renderer(void)
         SDL_DestroyWindow(g_window);
         g_window = NULL;
     }
+    if (g_offscreen_surface)
+    {
+        SDL_FreeSurface(g_offscreen_surface);
+        g_offscreen_surface = NULL;
+    }
 
     IMG_Quit();
     if (g_ttf_initialized)
@@ -1344,6 +1482,7 @@ static void ensure_window_matches_stage(const Stage *stage)
         g_window_w = target_w;
         g_window_h = target_h;
         update_tile_render_metrics();
+        dirty_rect_invalidate(g_dirty);
     }
 }
 
@@ -1423,6 +1562,7 @@ static void render_professor_clones(const Stage *stage,
         }
 
         draw_texture(texture, tx, ty, camera);
+        g_visible_counts.clones++;
     }
 }
 
@@ -1499,7 +1639,7 @@ static void render_hud(const Stage *stage, const Player *player, double elapsed_
             SDL_RenderFillRect(g_renderer, &scooter_rect);
         }
 
-        double scooter_remaining = player->scooter_expire_time - elapsed_time;
+        double scooter_remaining = player->scooter_expire_time - stage->sim_time; // 만료 시각은 시뮬레이션 시간 기준
         if (scooter_remaining < 0.0)
         {
             scooter_remaining = 0.0;
@@ -1532,13 +1672,334 @@ static void draw_texture(SDL_Texture *texture, int x, int y, const Camera *camer
     SDL_RenderCopy(g_renderer, texture, NULL, &dst);
 }
 
+void render_set_perf_stats(const RenderPerfStats *stats)
+{
+    if (stats)
+    {
+        g_perf_stats = *stats;
+    }
+}
+
+void render_toggle_perf_overlay(void)
+{
+    g_perf_overlay_enabled = !g_perf_overlay_enabled;
+    g_perf_text_refreshed_at = 0;
+}
+
+int render_set_vsync(int enabled)
+{
+    g_vsync_requested = enabled ? 1 : 0;
+    if (!g_renderer)
+    {
+        return g_vsync_requested;
+    }
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (!g_dirty && SDL_RenderSetVSync(g_renderer, g_vsync_requested) == 0)
+    {
+        g_vsync_active = g_vsync_requested;
+    }
+#endif
+    return g_vsync_active;
+}
+
+int render_vsync_active(void)
+{
+    return g_vsync_active;
+}
+
+double render_display_refresh_hz(void)
+{
+    if (!g_window)
+    {
+        return 0.0;
+    }
+    SDL_DisplayMode mode;
+    if (SDL_GetWindowDisplayMode(g_window, &mode) == 0 && mode.refresh_rate > 0)
+    {
+        return (double)mode.refresh_rate;
+    }
+    int display = SDL_GetWindowDisplayIndex(g_window);
+    if (display >= 0 && SDL_GetCurrentDisplayMode(display, &mode) == 0 && mode.refresh_rate > 0)
+    {
+        return (double)mode.refresh_rate;
+    }
+    return 0.0;
+}
+
+void render_set_frame_budget_ms(double budget_ms)
+{
+    if (budget_ms > 0.0)
+    {
+        g_frame_budget_ms = budget_ms;
+    }
+}
+
+void render_set_dynamic_resolution(int enabled)
+{
+    g_dynres_enabled = enabled ? 1 : 0;
+    if (!g_dynres_enabled)
+    {
+        g_dynres_level = 0;
+    }
+}
+
+// 현재 단계가 100%보다 낮으면 장면을 렌더 타깃에 축소해서 그리도록 전환. 전환했으면 1.
+static int begin_scaled_scene(void)
+{
+    if (!g_scene_target || !g_dynres_enabled || g_dynres_level == 0)
+    {
+        return 0;
+    }
+    if (SDL_SetRenderTarget(g_renderer, g_scene_target) != 0)
+    {
+        return 0;
+    }
+    float scale = kDynResScales[g_dynres_level];
+    SDL_RenderSetScale(g_renderer, scale, scale);
+    return 1;
+}
+
+// 축소해서 그린 장면을 원래 크기로 확대해 창에 복사
+static void end_scaled_scene(void)
+{
+    float scale = kDynResScales[g_dynres_level];
+    SDL_RenderSetScale(g_renderer, 1.0f, 1.0f);
+    SDL_SetRenderTarget(g_renderer, NULL);
+
+    SDL_Rect src = {0, 0, (int)lroundf(WINDOW_WIDTH * scale), (int)lroundf(WINDOW_HEIGHT * scale)};
+    SDL_Rect dst = {0, 0, WINDOW_WIDTH, WINDOW_HEIGHT};
+    SDL_RenderCopy(g_renderer, g_scene_target, &src, &dst);
+}
+
+// 최근 DYNRES_WINDOW 프레임 평균으로 다음 프레임의 해상도 단계 결정
+static void update_dynamic_resolution(void)
+{
+    if (!g_scene_target || !g_dynres_enabled)
+    {
+        return;
+    }
+
+    g_dynres_frames_since_change++;
+    if (g_dynres_frames_since_change < DYNRES_WINDOW || g_frame_ms_count < DYNRES_WINDOW)
+    {
+        return;
+    }
+
+    // 스테이지 로딩/메뉴 사이의 긴 간격 한 번이 평균을 망치지 않도록 샘플을 자름
+    const double sample_cap = g_frame_budget_ms * 4.0;
+    double sum = 0.0;
+    for (int i = 1; i <= DYNRES_WINDOW; ++i)
+    {
+        double ms = g_frame_ms_history[(g_frame_ms_next - i + PERF_FRAME_HISTORY) % PERF_FRAME_HISTORY];
+        sum += (ms < sample_cap) ? ms : sample_cap;
+    }
+    double avg_ms = sum / DYNRES_WINDOW;
+
+    if (avg_ms > g_frame_budget_ms * DYNRES_DOWN_RATIO)
+    {
+        if (g_dynres_level < DYNRES_LEVEL_COUNT - 1)
+        {
+            if (g_dynres_last_change_was_up)
+            {
+                g_dynres_up_stable_frames *= 2;
+                if (g_dynres_up_stable_frames > DYNRES_UP_STABLE_MAX)
+                    g_dynres_up_stable_frames = DYNRES_UP_STABLE_MAX;
+            }
+            g_dynres_level++;
+            g_dynres_frames_since_change = 0;
+            g_dynres_last_change_was_up = 0;
+        }
+        return;
+    }
+
+    if (g_dynres_last_change_was_up && g_dynres_frames_since_change >= DYNRES_WINDOW * 3)
+    {
+        // 올린 단계에서 버텼으므로 진동 방지용 대기 시간 초기화
+        g_dynres_last_change_was_up = 0;
+        g_dynres_up_stable_frames = DYNRES_UP_STABLE_MIN;
+    }
+
+    if (g_dynres_level > 0 && avg_ms < g_frame_budget_ms * DYNRES_UP_RATIO &&
+        g_dynres_frames_since_change >= g_dynres_up_stable_frames)
+    {
+        g_dynres_level--;
+        g_dynres_frames_since_change = 0;
+        g_dynres_last_change_was_up = 1;
+    }
+}
+
+// 직전 render() 호출과의 간격을 프레임 시간 링에 기록
+static void record_frame_time(void)
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (g_last_frame_counter != 0)
+    {
+        double ms = (double)(now - g_last_frame_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+        g_frame_ms_history[g_frame_ms_next] = (float)ms;
+        g_frame_ms_next = (g_frame_ms_next + 1) % PERF_FRAME_HISTORY;
+        if (g_frame_ms_count < PERF_FRAME_HISTORY)
+            g_frame_ms_count++;
+    }
+    g_last_frame_counter = now;
+}
+
+// 숫자가 매 프레임 바뀌면 읽을 수 없으므로 문자열은 250ms마다만 갱신 (그리기는 아틀라스라 래스터화 없음)
+static void refresh_perf_overlay_text(void)
+{
+    Uint32 now = SDL_GetTicks();
+    if (g_perf_text_refreshed_at != 0 && now - g_perf_text_refreshed_at < PERF_TEXT_REFRESH_MS)
+    {
+        return;
+    }
+    g_perf_text_refreshed_at = now ? now : 1;
+
+    double sum_ms = 0.0;
+    double worst_ms = 0.0;
+    for (int i = 0; i < g_frame_ms_count; ++i)
+    {
+        sum_ms += g_frame_ms_history[i];
+        if (g_frame_ms_history[i] > worst_ms)
+            worst_ms = g_frame_ms_history[i];
+    }
+    double avg_ms = (g_frame_ms_count > 0) ? sum_ms / g_frame_ms_count : 0.0;
+    double fps = (avg_ms > 0.0) ? 1000.0 / avg_ms : 0.0;
+
+    char (*lines)[128] = g_perf_text_lines;
+    snprintf(lines[0], sizeof(lines[0]), "FPS %.1f  frame %.2fms (max %.2f)  scale %d%%", fps, avg_ms, worst_ms,
+             g_scene_target ? (int)lroundf(kDynResScales[g_dynres_level] * 100.0f) : 100);
+    snprintf(lines[1], sizeof(lines[1]), "tick %.1f/%dHz  jitter %.2f/%.2fms  miss %lu",
+             g_perf_stats.tick_measured_hz, g_perf_stats.tick_hz,
+             g_perf_stats.tick_jitter_avg_ms, g_perf_stats.tick_jitter_max_ms,
+             g_perf_stats.tick_missed);
+    if (g_dirty)
+        snprintf(lines[2], sizeof(lines[2]), "draw calls %d  dirty %d rects %.1f%%", g_last_frame_draw_calls,
+                 g_last_dirty_rects, 100.0 * (double)g_last_dirty_pixels / ((double)WINDOW_WIDTH * WINDOW_HEIGHT));
+    else
+        snprintf(lines[2], sizeof(lines[2]), "draw calls %d", g_last_frame_draw_calls);
+    if (capture_active())
+    {
+        CaptureStats capture;
+        capture_get_stats(&capture);
+        size_t used = strlen(lines[2]);
+        snprintf(lines[2] + used, sizeof(lines[2]) - used, "  rec %lu drop %lu", capture.grabbed, capture.dropped);
+    }
+    snprintf(lines[3], sizeof(lines[3]), "visible obs %d  clone %d  item %d  proj %d  bullet %d",
+             g_visible_counts.obstacles, g_visible_counts.clones, g_visible_counts.items,
+             g_visible_counts.projectiles, g_visible_counts.bullets);
+    if (g_perf_stats.audio_voices >= 0)
+        snprintf(lines[4], sizeof(lines[4]), "audio voices %d  stage load %.1fms",
+                 g_perf_stats.audio_voices, g_perf_stats.stage_load_ms);
+    else
+        snprintf(lines[4], sizeof(lines[4]), "audio voices -  stage load %.1fms",
+                 g_perf_stats.stage_load_ms);
+
+    snprintf(lines[5], sizeof(lines[5]), "pacing %s %.0fHz (display %.0fHz)  err %.2f/%.2fms  long %lu",
+             g_perf_stats.pace_mode ? g_perf_stats.pace_mode : "-", g_perf_stats.pace_target_hz,
+             g_perf_stats.display_refresh_hz, g_perf_stats.pace_error_avg_ms, g_perf_stats.pace_error_max_ms,
+             g_perf_stats.pace_long_frames);
+
+    GlyphAtlasStats glyphs;
+    glyph_atlas_get_stats(g_ui_small_atlas, &glyphs);
+    snprintf(lines[6], sizeof(lines[6]), "glyphs %d  rasterized %d  pages %d  missing %d",
+             glyphs.glyphs, glyphs.rasterized, glyphs.pages, glyphs.missing);
+
+    const LockSiteSnapshot *lock = &g_perf_stats.stage_lock;
+    snprintf(lines[7], sizeof(lines[7]), "stage lock acq %lu cont %lu  wait max %.0fus  hold %.0f/%.0fus",
+             lock->acquisitions, lock->contended, lock->wait_max_us, lock->hold_avg_us, lock->hold_max_us);
+    snprintf(lines[8], sizeof(lines[8]), "seqlock retry %lu/%lu (max %.0fus)  queue full cmd %lu evt %lu",
+             g_perf_stats.seqlock_retries, g_perf_stats.seqlock_reads, g_perf_stats.seqlock_wait_max_us,
+             g_perf_stats.queue_commands_dropped, g_perf_stats.queue_events_dropped);
+}
+
+// 오버레이 자체 비용: 배경 1회 + 글리프 아틀라스 글자 PERF_OVERLAY_LINES줄 + 스파크라인 2회
+// - 글자는 줄마다 아틀라스 페이지당 SDL_RenderGeometry 1회 (더티 사각형 기록 중이면 글자마다 복사)
+static void render_perf_overlay(void)
+{
+    if (!g_perf_overlay_enabled || !g_renderer)
+    {
+        return;
+    }
+
+    refresh_perf_overlay_text();
+
+    const int graph_h = 48;
+    const int panel_x = g_window_w - 440 - HUD_MARGIN;
+    const int panel_y = HUD_MARGIN;
+    const int line_h = glyph_atlas_line_height(g_ui_small_atlas);
+    const int text_h = line_h * PERF_OVERLAY_LINES;
+    SDL_Rect panel = {panel_x, panel_y, 440, text_h + graph_h + 24};
+
+    SDL_SetRenderDrawBlendMode(g_renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(g_renderer, 0, 0, 0, 170);
+    SDL_RenderFillRect(g_renderer, &panel);
+    SDL_SetRenderDrawBlendMode(g_renderer, SDL_BLENDMODE_NONE);
+
+    int y = panel_y + 6;
+    SDL_Color text_color = {220, 255, 220, 255};
+    for (int i = 0; i < PERF_OVERLAY_LINES; ++i)
+    {
+        draw_atlas_text(g_ui_small_atlas, g_perf_text_lines[i], panel_x + 8, y, 1, text_color);
+        y += line_h;
+    }
+
+    // 프레임 시간 스파크라인: 33.3ms가 그래프 상단, 16.7ms 기준선 표시
+    const int graph_x = panel_x + 8;
+    const int graph_y = y + 8;
+    const int graph_w = panel.w - 16;
+    const double graph_max_ms = 1000.0 / 30.0;
+
+    int ref_y = graph_y + graph_h - (int)lround(graph_h * (1000.0 / 60.0) / graph_max_ms);
+    SDL_SetRenderDrawColor(g_renderer, 90, 90, 90, 255);
+    SDL_RenderDrawLine(g_renderer, graph_x, ref_y, graph_x + graph_w, ref_y);
+
+    if (g_frame_ms_count >= 2)
+    {
+        SDL_Point points[PERF_FRAME_HISTORY];
+        int oldest = (g_frame_ms_next - g_frame_ms_count + PERF_FRAME_HISTORY) % PERF_FRAME_HISTORY;
+        for (int i = 0; i < g_frame_ms_count; ++i)
+        {
+            double ms = g_frame_ms_history[(oldest + i) % PERF_FRAME_HISTORY];
+            if (ms > graph_max_ms)
+                ms = graph_max_ms;
+            points[i].x = graph_x + i * graph_w / (PERF_FRAME_HISTORY - 1);
+            points[i].y = graph_y + graph_h - (int)lround(graph_h * ms / graph_max_ms);
+        }
+        SDL_SetRenderDrawColor(g_renderer, 120, 255, 120, 255);
+        SDL_RenderDrawLines(g_renderer, points, g_frame_ms_count);
+    }
+
+    SDL_SetRenderDrawColor(g_renderer, 15, 15, 15, 255);
+}
+
 void render(const Stage *stage, const Player *player, double elapsed_time,
             int current_stage, int total_stages)
 {
     if (!g_renderer || !stage || !player)
         return;
 
+    // 플레이어도 직전/현재 틱 사이를 보간한 위치로 그림 (카메라/시야 포함)
+    Player shown_player = *player;
+    double player_tile_x = 0.0;
+    double player_tile_y = 0.0;
+    interpolate_tick_position((double)player->prev_world_x / SUBPIXELS_PER_TILE,
+                              (double)player->prev_world_y / SUBPIXELS_PER_TILE,
+                              (double)player->world_x / SUBPIXELS_PER_TILE,
+                              (double)player->world_y / SUBPIXELS_PER_TILE,
+                              &player_tile_x,
+                              &player_tile_y);
+    shown_player.world_x = (int)lround(player_tile_x * SUBPIXELS_PER_TILE);
+    shown_player.world_y = (int)lround(player_tile_y * SUBPIXELS_PER_TILE);
+    player = &shown_player;
+
     ensure_window_matches_stage(stage);
+    record_frame_time();
+    g_visible_counts = (VisibleEntityCounts){0};
+    if (g_dirty)
+    {
+        dirty_rect_begin_frame(g_dirty);
+        g_dirty_recording = 1;
+    }
+    int scaled_scene = begin_scaled_scene();
 
     int stage_width = (stage->width > 0) ? stage->width : MAX_X;
     int stage_height = (stage->height > 0) ? stage->height : MAX_Y;
@@ -1693,8 +2154,14 @@ void render(const Stage *stage, const Player *player, double elapsed_time,
 
         if (tex_to_draw)
         {
-            double obstacle_world_x = (double)o->world_x / SUBPIXELS_PER_TILE;
-            double obstacle_world_y = (double)o->world_y / SUBPIXELS_PER_TILE;
+            double obstacle_world_x = 0.0;
+            double obstacle_world_y = 0.0;
+            interpolate_tick_position((double)o->prev_world_x / SUBPIXELS_PER_TILE,
+                                      (double)o->prev_world_y / SUBPIXELS_PER_TILE,
+                                      (double)o->world_x / SUBPIXELS_PER_TILE,
+                                      (double)o->world_y / SUBPIXELS_PER_TILE,
+                                      &obstacle_world_x,
+                                      &obstacle_world_y);
             int tile_x = (int)floor(obstacle_world_x);
             int tile_y = (int)floor(obstacle_world_y);
             if (tile_x < 0 || tile_y < 0 || tile_x >= stage_width || tile_y >= stage_height)
@@ -1702,6 +2169,7 @@ void render(const Stage *stage, const Player *player, double elapsed_time,
             if (!visibility[tile_y][tile_x])
                 continue;
             draw_texture_at_world(tex_to_draw, obstacle_world_x, obstacle_world_y, &camera);
+            g_visible_counts.obstacles++;
             if (o->kind == OBSTACLE_KIND_PROFESSOR && current_prof_label_index >= 0)
             {
                 draw_professor_nameplate(current_prof_label_index, obstacle_world_x, obstacle_world_y, &camera);
@@ -1748,6 +2216,7 @@ void render(const Stage *stage, const Player *player, double elapsed_time,
         if (!visibility[tile_y][tile_x])
             continue;
         draw_texture_with_pixel_offset(item_tex, tile_x, tile_y, 0, offset_y, &camera);
+        g_visible_counts.items++;
     } // 아이템 렌더링
 
     for (int i = 0; i < stage->num_projectiles; i++)
@@ -1755,8 +2224,14 @@ void render(const Stage *stage, const Player *player, double elapsed_time,
         const Projectile *p = &stage->projectiles[i];
         if (p->active)
         {
-            double projectile_world_x = (double)p->world_x / SUBPIXELS_PER_TILE;
-            double projectile_world_y = (double)p->world_y / SUBPIXELS_PER_TILE;
+            double projectile_world_x = 0.0;
+            double projectile_world_y = 0.0;
+            interpolate_tick_position((double)p->prev_world_x / SUBPIXELS_PER_TILE,
+                                      (double)p->prev_world_y / SUBPIXELS_PER_TILE,
+                                      (double)p->world_x / SUBPIXELS_PER_TILE,
+                                      (double)p->world_y / SUBPIXELS_PER_TILE,
+                                      &projectile_world_x,
+                                      &projectile_world_y);
             int tile_x = (int)floor(projectile_world_x);
             int tile_y = (int)floor(projectile_world_y);
             if (tile_x < 0 || tile_y < 0 || tile_x >= stage_width || tile_y >= stage_height)
@@ -1764,6 +2239,7 @@ void render(const Stage *stage, const Player *player, double elapsed_time,
             if (!visibility[tile_y][tile_x])
                 continue;
             draw_texture_at_world(g_tex_projectile, projectile_world_x, projectile_world_y, &camera);
+            g_visible_counts.projectiles++;
         }
     } // 투사체 렌더링
 
@@ -1776,8 +2252,11 @@ void render(const Stage *stage, const Player *player, double elapsed_time,
             {
                 continue;
             }
-            double tile_x = bullet->world_x;
-            double tile_y = bullet->world_y;
+            double tile_x = 0.0;
+            double tile_y = 0.0;
+            interpolate_tick_position(bullet->prev_world_x, bullet->prev_world_y,
+                                      bullet->world_x, bullet->world_y,
+                                      &tile_x, &tile_y);
             int cell_x = (int)floor(tile_x);
             int cell_y = (int)floor(tile_y);
             if (cell_x < 0 || cell_y < 0 || cell_x >= stage_width || cell_y >= stage_height)
@@ -1789,6 +2268,7 @@ void render(const Stage *stage, const Player *player, double elapsed_time,
                 continue;
             }
             draw_texture_at_world(g_tex_professor_bullet, tile_x, tile_y, &camera);
+            g_visible_counts.bullets++;
         }
     }
 
@@ -1878,10 +2358,19 @@ void render(const Stage *stage, const Player *player, double elapsed_time,
     }
     SDL_SetRenderDrawBlendMode(g_renderer, SDL_BLENDMODE_NONE);
 
+    if (scaled_scene)
+    {
+        end_scaled_scene();
+    }
     render_hud(stage, player, elapsed_time);
+    render_perf_overlay();
+    update_dynamic_resolution();
 
     // 패턴 확인용 주석처리
-    SDL_RenderPresent(g_renderer);
+    if (g_dirty)
+        present_dirty_frame();
+    else
+        present_frame();
 
     (void)current_stage;
     (void)total_stages;
@@ -1895,7 +2384,7 @@ void render_title_screen(int selected_index)
         return;
     }
 
-    if (selected_index < 0 || selected_index >= ARRAY_LEN(g_title_menu_options))
+    if (selected_index < 0 || selected_index >= ARRAY_LEN(kTitleMenuLabels))
     {
         selected_index = 0;
     }
@@ -1910,17 +2399,10 @@ void render_title_screen(int selected_index)
     }
 
     SDL_Color title_color = {255, 255, 255, 255};
-    update_cached_text(&g_title_logo_cache, get_large_ui_font(), "교수님 피하기", title_color);
-    if (g_title_logo_cache.texture)
-    {
-        const int scaled_w = g_title_logo_cache.width * 2;
-        const int scaled_h = g_title_logo_cache.height * 2;
-        SDL_Rect logo_dst = {WINDOW_WIDTH / 2 - scaled_w / 2,
-                             30,
-                             scaled_w,
-                             scaled_h};
-        SDL_RenderCopy(g_renderer, g_title_logo_cache.texture, NULL, &logo_dst);
-    }
+    const char *title_text = "교수님 피하기";
+    int title_w = 0;
+    glyph_atlas_measure(g_ui_large_atlas, title_text, &title_w, NULL);
+    draw_atlas_text(g_ui_large_atlas, title_text, WINDOW_WIDTH / 2 - title_w, 30, 2, title_color);
 
     SDL_Rect panel = {WINDOW_WIDTH - 380, 60, 320, WINDOW_HEIGHT - 120};
     SDL_SetRenderDrawBlendMode(g_renderer, SDL_BLENDMODE_BLEND);
@@ -1929,39 +2411,36 @@ void render_title_screen(int selected_index)
 
     const int base_y = panel.y + 120;
     const int option_spacing = 110;
-    for (int i = 0; i < ARRAY_LEN(g_title_menu_options); ++i)
+    const SDL_Color normal_color = {200, 200, 200, 255};
+    const SDL_Color highlight_color = {255, 255, 255, 255};
+    for (int i = 0; i < ARRAY_LEN(kTitleMenuLabels); ++i)
     {
-        const MenuOptionTexture *option = &g_title_menu_options[i];
-        SDL_Texture *tex = (i == selected_index) ? option->highlight : option->normal;
-        if (!tex)
-        {
-            continue;
-        }
+        int option_w = 0;
+        int option_h = 0;
+        glyph_atlas_measure(g_ui_large_atlas, kTitleMenuLabels[i], &option_w, &option_h);
 
-        const int dst_x = panel.x + (panel.w - option->width) / 2;
+        const int dst_x = panel.x + (panel.w - option_w) / 2;
         const int dst_y = base_y + i * option_spacing;
         if (i == selected_index)
         {
-            SDL_Rect highlight = {panel.x + 20, dst_y - 18, panel.w - 40, option->height + 36};
+            SDL_Rect highlight = {panel.x + 20, dst_y - 18, panel.w - 40, option_h + 36};
             SDL_SetRenderDrawColor(g_renderer, 90, 120, 210, 110);
             SDL_RenderFillRect(g_renderer, &highlight);
         }
 
-        SDL_Rect dst = {dst_x, dst_y, option->width, option->height};
-        SDL_RenderCopy(g_renderer, tex, NULL, &dst);
+        draw_atlas_text(g_ui_large_atlas, kTitleMenuLabels[i], dst_x, dst_y, 1,
+                        (i == selected_index) ? highlight_color : normal_color);
     }
 
-    if (g_title_hint_texture.texture)
-    {
-        SDL_Rect hint = {panel.x + (panel.w - g_title_hint_texture.width) / 2,
-                         panel.y + panel.h - g_title_hint_texture.height - 24,
-                         g_title_hint_texture.width,
-                         g_title_hint_texture.height};
-        SDL_RenderCopy(g_renderer, g_title_hint_texture.texture, NULL, &hint);
-    }
+    const SDL_Color hint_color = {180, 180, 180, 255};
+    int hint_w = 0;
+    int hint_h = 0;
+    glyph_atlas_measure(g_ui_small_atlas, kTitleHintText, &hint_w, &hint_h);
+    draw_atlas_text(g_ui_small_atlas, kTitleHintText, panel.x + (panel.w - hint_w) / 2,
+                    panel.y + panel.h - hint_h - 24, 1, hint_color);
 
     SDL_SetRenderDrawBlendMode(g_renderer, SDL_BLENDMODE_NONE);
-    SDL_RenderPresent(g_renderer);
+    present_frame();
 }
 
 void render_records_screen(double best_time)
@@ -1996,28 +2475,21 @@ void render_records_screen(double best_time)
     }
 
     SDL_Color text_color = {240, 240, 240, 255};
-    update_cached_text(&g_records_best_cache, get_large_ui_font(), record_text, text_color);
-    if (g_records_best_cache.texture)
-    {
-        SDL_Rect dst = {
-            WINDOW_WIDTH / 2 - g_records_best_cache.width / 2,
-            WINDOW_HEIGHT / 2 - g_records_best_cache.height / 2,
-            g_records_best_cache.width,
-            g_records_best_cache.height};
-        SDL_RenderCopy(g_renderer, g_records_best_cache.texture, NULL, &dst);
-    }
-
-    if (g_records_hint_texture.texture)
-    {
-        SDL_Rect dst = {WINDOW_WIDTH / 2 - g_records_hint_texture.width / 2,
-                         overlay.y + overlay.h - g_records_hint_texture.height - 30,
-                         g_records_hint_texture.width,
-                         g_records_hint_texture.height};
-        SDL_RenderCopy(g_renderer, g_records_hint_texture.texture, NULL, &dst);
-    }
+    int record_w = 0;
+    int record_h = 0;
+    glyph_atlas_measure(g_ui_large_atlas, record_text, &record_w, &record_h);
+    draw_atlas_text(g_ui_large_atlas, record_text, WINDOW_WIDTH / 2 - record_w / 2,
+                    WINDOW_HEIGHT / 2 - record_h / 2, 1, text_color);
+
+    const SDL_Color hint_color = {180, 180, 180, 255};
+    int hint_w = 0;
+    int hint_h = 0;
+    glyph_atlas_measure(g_ui_small_atlas, kRecordsHintText, &hint_w, &hint_h);
+    draw_atlas_text(g_ui_small_atlas, kRecordsHintText, WINDOW_WIDTH / 2 - hint_w / 2,
+                    overlay.y + overlay.h - hint_h - 30, 1, hint_color);
 
     SDL_SetRenderDrawBlendMode(g_renderer, SDL_BLENDMODE_NONE);
-    SDL_RenderPresent(g_renderer);
+    present_frame();
 }
 
 void render_game_over_screen(void)
@@ -2036,17 +2508,9 @@ void render_game_over_screen(void)
     SDL_RenderFillRect(g_renderer, &overlay);
 
     SDL_Color title_color = {255, 120, 120, 255};
-    update_cached_text(&g_game_over_title_cache, get_large_ui_font(), "재수강", title_color);
-    if (g_game_over_title_cache.texture)
-    {
-        const int scaled_w = g_game_over_title_cache.width * 2;
-        const int scaled_h = g_game_over_title_cache.height * 2;
-        SDL_Rect dst = {WINDOW_WIDTH / 2 - scaled_w / 2,
-                         60,
-                         scaled_w,
-                         scaled_h};
-        SDL_RenderCopy(g_renderer, g_game_over_title_cache.texture, NULL, &dst);
-    }
+    int title_w = 0;
+    glyph_atlas_measure(g_ui_large_atlas, "재수강", &title_w, NULL);
+    draw_atlas_text(g_ui_large_atlas, "재수강", WINDOW_WIDTH / 2 - title_w, 60, 2, title_color);
 
     const int image_top = 170;
     const int image_bottom_margin = 150;
@@ -2091,15 +2555,13 @@ void render_game_over_screen(void)
         SDL_RenderCopy(g_renderer, g_tex_game_over_image, NULL, &img_dst);
     }
 
-    if (g_game_over_hint_texture.texture)
-    {
-        SDL_Rect dst = {WINDOW_WIDTH / 2 - g_game_over_hint_texture.width / 2,
-                         WINDOW_HEIGHT - g_game_over_hint_texture.height - 40,
-                         g_game_over_hint_texture.width,
-                         g_game_over_hint_texture.height};
-        SDL_RenderCopy(g_renderer, g_game_over_hint_texture.texture, NULL, &dst);
-    }
+    const SDL_Color hint_color = {180, 180, 180, 255};
+    int hint_w = 0;
+    int hint_h = 0;
+    glyph_atlas_measure(g_ui_small_atlas, kGameOverHintText, &hint_w, &hint_h);
+    draw_atlas_text(g_ui_small_atlas, kGameOverHintText, WINDOW_WIDTH / 2 - hint_w / 2,
+                    WINDOW_HEIGHT - hint_h - 40, 1, hint_color);
 
     SDL_SetRenderDrawBlendMode(g_renderer, SDL_BLENDMODE_NONE);
-    SDL_RenderPresent(g_renderer);
+    present_frame();
 }
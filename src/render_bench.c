@@ -0,0 +1,287 @@
+#define _POSIX_C_SOURCE 199309L
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "../include/game.h"
+#include "../include/obstacle.h"
+#include "../include/player.h"
+#include "../include/render.h"
+#include "../include/render_bench.h"
+#include "../include/simulation.h"
+#include "../include/sound.h"
+#include "../include/stage.h"
+
+#define RENDER_BENCH_WARMUP_FRAMES 30 // 첫 프레임들의 지연 업로드/캐시 적중 차이는 측정에서 뺌
+#define RENDER_BENCH_FIRE_INTERVAL 25 // 발사 간격 (틱)
+#define RENDER_BENCH_SEED 12345
+
+// 누르고 있는 방향을 틱 수마다 바꿔 가며 반복 (맵과 무관하게 이동/벽 충돌/정지가 섞이도록)
+typedef struct
+{
+    int key;
+    int ticks;
+} ScriptStep;
+
+static const ScriptStep kScript[] = {
+    {'d', 40}, {'s', 30}, {'a', 40}, {'w', 30}, {'d', 20}, {-1, 10}, {'s', 20}, {'a', 20}, {'w', 20}};
+
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int script_key_at(int tick)
+{
+    int total = 0;
+    for (size_t i = 0; i < sizeof(kScript) / sizeof(kScript[0]); ++i)
+        total += kScript[i].ticks;
+
+    int t = tick % total;
+    for (size_t i = 0; i < sizeof(kScript) / sizeof(kScript[0]); ++i)
+    {
+        if (t < kScript[i].ticks)
+            return kScript[i].key;
+        t -= kScript[i].ticks;
+    }
+    return -1;
+}
+
+// 스테이지가 끝나도(실패/클리어) 같은 초기 상태에서 다시 시작해 프레임 수를 채움
+// - 부순 벽이 PVS/이동 필드에 반영되므로 구조체 복사 대신 매번 새로 로드
+static int restart_session(Stage *stage, int stage_id, Player *player)
+{
+    set_obstacle_player_ref(NULL);
+    unload_stage(stage);
+    if (load_stage(stage, stage_id) != 0)
+        return -1;
+    init_player(player, stage);
+    set_obstacle_player_ref(player);
+    rng_seed(&stage->rng, RENDER_BENCH_SEED);
+    simulation_begin_stage();
+    return 0;
+}
+
+static void feed_script(int tick, int *held)
+{
+    int key = script_key_at(tick);
+    if (key != *held)
+    {
+        PlayerCommand cmd = {.type = PLAYER_COMMAND_HOLD_DIRECTION, .key = key};
+        if (simulation_push_command(&cmd))
+            *held = key;
+    }
+    if (tick > 0 && tick % RENDER_BENCH_FIRE_INTERVAL == 0)
+    {
+        PlayerCommand cmd = {.type = PLAYER_COMMAND_FIRE, .key = 'k'};
+        simulation_push_command(&cmd);
+    }
+}
+
+static uint64_t hash_surface(const SDL_Surface *surface, uint64_t hash)
+{
+    const unsigned char *row = (const unsigned char *)surface->pixels;
+    const size_t row_bytes = (size_t)surface->w * 4u;
+    for (int y = 0; y < surface->h; ++y, row += surface->pitch)
+    {
+        for (size_t x = 0; x < row_bytes; ++x)
+        {
+            hash ^= row[x];
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+static int dump_frame(SDL_Surface *surface, const RenderBenchOptions *options, int frame, FILE *raw)
+{
+    if (options->dump_format == RENDER_DUMP_RAW)
+    {
+        const unsigned char *row = (const unsigned char *)surface->pixels;
+        for (int y = 0; y < surface->h; ++y, row += surface->pitch)
+        {
+            if (fwrite(row, 4u, (size_t)surface->w, raw) != (size_t)surface->w)
+                return -1;
+        }
+        return 0;
+    }
+
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame_%06d.png", options->dump_dir, frame);
+    if (IMG_SavePNG(surface, path) != 0)
+    {
+        fprintf(stderr, "프레임 저장 실패 (%s): %s\n", path, IMG_GetError());
+        return -1;
+    }
+    return 0;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+static double percentile(const double *sorted, int count, double p)
+{
+    int index = (int)(p * (count - 1) + 0.5);
+    return sorted[index];
+}
+
+int run_render_benchmark(int stage_id, const RenderBenchOptions *options)
+{
+    static Stage stage;
+
+    const int frames = (options->frames > 0) ? options->frames : 600;
+    const int sample_every = (options->sample_every > 0) ? options->sample_every : 60;
+
+    FILE *raw = NULL;
+    if (options->dump_dir)
+    {
+        if (mkdir(options->dump_dir, 0755) != 0 && errno != EEXIST)
+        {
+            fprintf(stderr, "프레임 저장 디렉터리를 만들 수 없음: %s\n", options->dump_dir);
+            return 1;
+        }
+        if (options->dump_format == RENDER_DUMP_RAW)
+        {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/frames.argb", options->dump_dir);
+            raw = fopen(path, "wb");
+            if (!raw)
+            {
+                fprintf(stderr, "raw 프레임 파일을 열 수 없음: %s\n", path);
+                return 1;
+            }
+        }
+    }
+
+    double *frame_ms = malloc(sizeof(double) * (size_t)frames);
+    if (!frame_ms || init_offscreen_renderer() != 0)
+    {
+        fprintf(stderr, "렌더 벤치마크 초기화 실패\n");
+        free(frame_ms);
+        if (raw)
+            fclose(raw);
+        return 1;
+    }
+    // 프레임 시간에 따라 해상도가 바뀌면 측정/해시가 흔들리므로 끔
+    render_set_dynamic_resolution(0);
+    render_prepare_stage(stage_id);
+    Player player;
+    if (render_finish_assets() != 0 || restart_session(&stage, stage_id, &player) != 0)
+    {
+        fprintf(stderr, "렌더 벤치마크용 스테이지 %d 준비 실패\n", stage_id);
+        set_obstacle_player_ref(NULL);
+        unload_stage(&stage);
+        shutdown_renderer();
+        free(frame_ms);
+        if (raw)
+            fclose(raw);
+        return 1;
+    }
+    set_sfx_muted(1);
+
+    SDL_Surface *surface = render_offscreen_surface();
+    const double dt = 1.0 / get_obstacle_tick_rate();
+    printf("렌더 벤치마크: 스테이지 %d (%s), %dx%d 소프트웨어 렌더러, 워밍업 %d + %d프레임 (프레임당 시뮬레이션 1틱, dt %.4fs)\n",
+           stage_id, stage.name, surface->w, surface->h, RENDER_BENCH_WARMUP_FRAMES, frames, dt);
+
+    render_set_tick_alpha(1.0);
+
+    uint64_t hash = 1469598103934665603ULL;
+    int dumped = 0;
+    int restarts = 0;
+    int dump_failed = 0;
+    int reload_failed = 0;
+    int held = -1;
+    int tick = 0;
+    for (int i = -RENDER_BENCH_WARMUP_FRAMES; i < frames; ++i, ++tick)
+    {
+        if (simulation_get_outcome() != SIM_OUTCOME_RUNNING)
+        {
+            if (restart_session(&stage, stage_id, &player) != 0)
+            {
+                reload_failed = 1;
+                break;
+            }
+            held = -1;
+            restarts++;
+        }
+        feed_script(tick, &held);
+        simulation_step(&stage, &player, dt);
+        SimEvent ev;
+        while (simulation_poll_event(&ev))
+        {
+        }
+
+        double start = now_sec();
+        render(&stage, &player, stage.sim_time, 1, 1);
+        double elapsed_ms = (now_sec() - start) * 1000.0;
+        if (i < 0)
+            continue;
+
+        frame_ms[i] = elapsed_ms;
+        if ((i + 1) % sample_every == 0)
+        {
+            hash = hash_surface(surface, hash);
+            if (options->dump_dir && !dump_failed)
+            {
+                if (dump_frame(surface, options, i + 1, raw) == 0)
+                    dumped++;
+                else
+                    dump_failed = 1;
+            }
+        }
+    }
+
+    if (reload_failed)
+    {
+        fprintf(stderr, "렌더 벤치마크용 스테이지 %d 다시 로드 실패\n", stage_id);
+        set_obstacle_player_ref(NULL);
+        unload_stage(&stage);
+        shutdown_renderer();
+        free(frame_ms);
+        if (raw)
+            fclose(raw);
+        return 1;
+    }
+
+    double sum = 0.0;
+    for (int i = 0; i < frames; ++i)
+        sum += frame_ms[i];
+    qsort(frame_ms, (size_t)frames, sizeof(double), compare_double);
+    const double avg = sum / frames;
+
+    printf("프레임당 렌더: 평균 %.3fms (%.1f FPS), p50 %.3fms, p95 %.3fms, p99 %.3fms, 최대 %.3fms\n",
+           avg, avg > 0.0 ? 1000.0 / avg : 0.0,
+           percentile(frame_ms, frames, 0.50), percentile(frame_ms, frames, 0.95),
+           percentile(frame_ms, frames, 0.99), frame_ms[frames - 1]);
+    printf("스테이지 재시작 %d회, %d프레임마다 표본 해시: %016llx\n", restarts, sample_every, (unsigned long long)hash);
+    if (options->dump_dir)
+    {
+        if (options->dump_format == RENDER_DUMP_RAW)
+            printf("저장: %s/frames.argb (%dx%d ARGB8888, pitch %d, %d프레임)\n",
+                   options->dump_dir, surface->w, surface->h, surface->w * 4, dumped);
+        else
+            printf("저장: %s/frame_*.png (%d장)\n", options->dump_dir, dumped);
+    }
+
+    set_obstacle_player_ref(NULL);
+    unload_stage(&stage);
+    shutdown_renderer();
+    free(frame_ms);
+    int result = dump_failed ? 1 : 0;
+    if (raw && fclose(raw) != 0)
+        result = 1;
+    return result;
+}
@@ -0,0 +1,97 @@
+#include "../include/rng.h"
+
+static inline uint32_t rotl32(uint32_t x, int k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+static uint64_t splitmix64(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+void rng_seed(Rng *rng, uint64_t seed)
+{
+    uint64_t a = splitmix64(&seed);
+    uint64_t b = splitmix64(&seed);
+    rng->s[0] = (uint32_t)a;
+    rng->s[1] = (uint32_t)(a >> 32);
+    rng->s[2] = (uint32_t)b;
+    rng->s[3] = (uint32_t)(b >> 32);
+
+    // 상태가 전부 0이면 영원히 0만 나옴
+    if ((rng->s[0] | rng->s[1] | rng->s[2] | rng->s[3]) == 0)
+        rng->s[0] = 1;
+}
+
+uint32_t rng_next(Rng *rng)
+{
+    uint32_t *s = rng->s;
+    const uint32_t result = rotl32(s[1] * 5, 7) * 9;
+    const uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl32(s[3], 11);
+
+    return result;
+}
+
+int rng_below(Rng *rng, int bound)
+{
+    if (bound <= 0)
+        return 0;
+
+    // Lemire 곱셈 방식: 나머지 연산 편향 없이 대부분 곱셈 한 번
+    uint32_t range = (uint32_t)bound;
+    uint64_t m = (uint64_t)rng_next(rng) * range;
+    uint32_t low = (uint32_t)m;
+    if (low < range)
+    {
+        uint32_t threshold = (uint32_t)(-range) % range;
+        while (low < threshold)
+        {
+            m = (uint64_t)rng_next(rng) * range;
+            low = (uint32_t)m;
+        }
+    }
+    return (int)(m >> 32);
+}
+
+int rng_range(Rng *rng, int lo, int hi)
+{
+    if (hi <= lo)
+        return lo;
+    return lo + rng_below(rng, hi - lo + 1);
+}
+
+int rng_pick_distinct(Rng *rng, int n, int k, int *out)
+{
+    if (n <= 0 || k <= 0)
+        return 0;
+    if (k > n)
+        k = n;
+
+    // Floyd: j = n-k .. n-1 마다 [0, j]에서 하나 뽑고, 이미 있으면 j를 대신 넣음 (k는 작다고 가정, O(k^2))
+    int count = 0;
+    for (int j = n - k; j < n; ++j)
+    {
+        int pick = rng_below(rng, j + 1);
+        for (int i = 0; i < count; ++i)
+        {
+            if (out[i] == pick)
+            {
+                pick = j;
+                break;
+            }
+        }
+        out[count++] = pick;
+    }
+    return count;
+}
@@ -0,0 +1,300 @@
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "../include/simulation.h"
+#include "../include/hazard.h"
+#include "../include/obstacle.h"
+#include "../include/player.h"
+#include "../include/professor_pattern.h"
+#include "../include/projectile.h"
+#include "../include/spsc_queue.h"
+
+extern int is_goal_reached(const Stage *stage, const Player *player);
+extern int check_collision(const Stage *stage, const Player *player, int *shieldable_index);
+
+#define PLAYER_COMMAND_QUEUE_SIZE 64 // 2의 거듭제곱
+#define SIM_EVENT_QUEUE_SIZE 256     // 2의 거듭제곱
+
+static const double kScooterDurationSec = 20.0;
+static const double kWalkSfxIntervalBaseSec = 0.45;
+static const double kWalkSfxIntervalScooterSec = 0.25;
+
+static PlayerCommand g_command_storage[PLAYER_COMMAND_QUEUE_SIZE];
+static SimEvent g_event_storage[SIM_EVENT_QUEUE_SIZE];
+static SpscQueue g_command_queue;
+static SpscQueue g_event_queue;
+
+static atomic_int g_outcome = SIM_OUTCOME_RUNNING;
+
+// 큐가 가득 차서 넣지 못한 횟수 (각각 넣는 스레드만 갱신, 스테이지가 바뀌어도 누적)
+static atomic_ulong g_commands_pushed = 0;
+static atomic_ulong g_commands_dropped = 0;
+static atomic_ulong g_events_dropped = 0;
+
+// 아래는 시뮬레이션 스레드 전용 상태
+static int g_held_direction = -1;
+static double g_last_walk_sfx_time = 0.0;
+
+void simulation_begin_stage(void)
+{
+    spsc_queue_init(&g_command_queue, g_command_storage, PLAYER_COMMAND_QUEUE_SIZE, sizeof(PlayerCommand));
+    spsc_queue_init(&g_event_queue, g_event_storage, SIM_EVENT_QUEUE_SIZE, sizeof(SimEvent));
+    atomic_store(&g_outcome, SIM_OUTCOME_RUNNING);
+    g_held_direction = -1;
+    g_last_walk_sfx_time = 0.0;
+}
+
+int simulation_push_command(const PlayerCommand *cmd)
+{
+    int pushed = spsc_queue_push(&g_command_queue, cmd);
+    atomic_fetch_add_explicit(pushed ? &g_commands_pushed : &g_commands_dropped, 1, memory_order_relaxed);
+    return pushed;
+}
+
+int simulation_poll_event(SimEvent *out)
+{
+    return spsc_queue_pop(&g_event_queue, out);
+}
+
+SimOutcome simulation_get_outcome(void)
+{
+    return (SimOutcome)atomic_load(&g_outcome);
+}
+
+void simulation_get_queue_stats(SimulationQueueStats *out)
+{
+    if (!out)
+        return;
+    out->commands_pushed = atomic_load_explicit(&g_commands_pushed, memory_order_relaxed);
+    out->commands_dropped = atomic_load_explicit(&g_commands_dropped, memory_order_relaxed);
+    out->events_dropped = atomic_load_explicit(&g_events_dropped, memory_order_relaxed);
+}
+
+// 이벤트 큐가 가득 차면 효과음 정도만 빠지고, 스테이지 결과는 g_outcome으로 따로 전달됨
+static void emit_event(SimEventType type, SimHazardSource source, int value)
+{
+    SimEvent ev = {.type = type, .source = source, .item_type = ITEM_TYPE_SHIELD, .value = value};
+    if (!spsc_queue_push(&g_event_queue, &ev))
+        atomic_fetch_add_explicit(&g_events_dropped, 1, memory_order_relaxed);
+}
+
+static void finish_stage(SimOutcome outcome, SimHazardSource source)
+{
+    emit_event(outcome == SIM_OUTCOME_CLEARED ? SIM_EVENT_STAGE_CLEARED : SIM_EVENT_STAGE_FAILED, source, 0);
+    atomic_store(&g_outcome, outcome);
+}
+
+static void save_previous_tick_positions(Stage *stage, Player *player)
+{
+    for (int i = 0; i < stage->num_obstacles; i++)
+    {
+        Obstacle *o = &stage->obstacles[i];
+        o->prev_world_x = o->world_x;
+        o->prev_world_y = o->world_y;
+    }
+
+    for (int i = 0; i < MAX_PROFESSOR_BULLETS; ++i)
+    {
+        ProfessorBullet *bullet = &stage->professor_bullets[i];
+        bullet->prev_world_x = bullet->world_x;
+        bullet->prev_world_y = bullet->world_y;
+    }
+
+    for (int i = 0; i < stage->num_projectiles; ++i)
+    {
+        Projectile *p = &stage->projectiles[i];
+        p->prev_world_x = p->world_x;
+        p->prev_world_y = p->world_y;
+    }
+
+    player->prev_world_x = player->world_x;
+    player->prev_world_y = player->world_y;
+}
+
+static void step_player(Player *player, int key, Stage *stage)
+{
+    move_player(player, (char)key, stage, stage->sim_time);
+
+    double walk_interval = player->has_scooter ? kWalkSfxIntervalScooterSec : kWalkSfxIntervalBaseSec;
+    if (stage->sim_time - g_last_walk_sfx_time >= walk_interval)
+    {
+        emit_event(SIM_EVENT_WALK, SIM_HAZARD_NONE, 0);
+        g_last_walk_sfx_time = stage->sim_time;
+    }
+}
+
+// 이번 틱에 쌓인 명령을 모두 적용. 방향키 입력이 있었으면 1
+static int apply_player_commands(Stage *stage, Player *player)
+{
+    int stepped = 0;
+    PlayerCommand cmd;
+    while (spsc_queue_pop(&g_command_queue, &cmd))
+    {
+        switch (cmd.type)
+        {
+        case PLAYER_COMMAND_HOLD_DIRECTION:
+            g_held_direction = cmd.key;
+            break;
+        case PLAYER_COMMAND_STEP:
+            step_player(player, cmd.key, stage);
+            stepped = 1;
+            break;
+        case PLAYER_COMMAND_FIRE:
+            if (stage->remaining_ammo > 0)
+            {
+                fire_projectile(stage, player);
+                emit_event(SIM_EVENT_FIRE, SIM_HAZARD_NONE, stage->remaining_ammo);
+            }
+            else
+            {
+                emit_event(SIM_EVENT_FIRE_EMPTY, SIM_HAZARD_NONE, 0);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return stepped;
+}
+
+static void pick_up_items(Stage *stage, Player *player)
+{
+    for (int i = 0; i < stage->num_items; i++)
+    {
+        Item *it = &stage->items[i];
+        if (!it->active)
+            continue;
+
+        int item_tile_x = it->world_x / SUBPIXELS_PER_TILE;
+        int item_tile_y = it->world_y / SUBPIXELS_PER_TILE;
+        if (!is_tile_center_inside_player(player, item_tile_x, item_tile_y))
+            continue;
+
+        it->active = 0;
+
+        SimEvent ev = {.type = SIM_EVENT_ITEM_PICKED, .source = SIM_HAZARD_NONE, .item_type = it->type};
+        switch (it->type)
+        {
+        case ITEM_TYPE_SHIELD:
+            player->shield_count++;
+            ev.value = player->shield_count;
+            break;
+        case ITEM_TYPE_SCOOTER:
+        {
+            const double scooter_multiplier = 2.0;
+            player->has_scooter = 1;
+            player->speed_multiplier = scooter_multiplier;
+            player->move_speed = player->base_move_speed * player->speed_multiplier;
+            player->scooter_expire_time = stage->sim_time + kScooterDurationSec;
+            ev.value_f = player->speed_multiplier;
+            break;
+        }
+        case ITEM_TYPE_SUPPLY:
+            stage->remaining_ammo += SUPPLY_REFILL_AMOUNT;
+            ev.value = stage->remaining_ammo;
+            break;
+        default:
+            break;
+        }
+        if (!spsc_queue_push(&g_event_queue, &ev))
+            atomic_fetch_add_explicit(&g_events_dropped, 1, memory_order_relaxed);
+    }
+}
+
+// 함정/장애물/탄환 판정. 스테이지가 끝나면 1
+static int check_hazards(Stage *stage, Player *player, ProfessorBulletResult bullet_result)
+{
+    if (check_trap_collision(stage, player))
+    {
+        if (player->shield_count <= 0)
+        {
+            finish_stage(SIM_OUTCOME_FAILED, SIM_HAZARD_TRAP);
+            return 1;
+        }
+        player->shield_count--;
+        emit_event(SIM_EVENT_SHIELD_BLOCKED, SIM_HAZARD_TRAP, player->shield_count);
+        // 쉴드로 막아도 같은 틱의 장애물/탈출/교수 탄환 판정은 계속함 (스테이지가 끝날 때만 중단)
+    }
+
+    int shieldable_index = -1;
+    if (check_collision(stage, player, &shieldable_index))
+    {
+        if (shieldable_index < 0)
+        {
+            finish_stage(SIM_OUTCOME_FAILED, SIM_HAZARD_OBSTACLE);
+            return 1;
+        }
+        player->shield_count--;
+        stage->obstacles[shieldable_index].active = 0; // 일반 장애물 제거
+        hazard_sync_obstacle(stage, shieldable_index);
+    }
+
+    if (is_goal_reached(stage, player))
+    {
+        finish_stage(SIM_OUTCOME_CLEARED, SIM_HAZARD_NONE);
+        return 1;
+    }
+
+    if (bullet_result == PROFESSOR_BULLET_RESULT_SHIELD_BLOCKED)
+    {
+        emit_event(SIM_EVENT_SHIELD_BLOCKED, SIM_HAZARD_BULLET, player->shield_count);
+    }
+    else if (bullet_result == PROFESSOR_BULLET_RESULT_FATAL)
+    {
+        finish_stage(SIM_OUTCOME_FAILED, SIM_HAZARD_BULLET);
+        return 1;
+    }
+    return 0;
+}
+
+void simulation_step(Stage *stage, Player *player, double dt)
+{
+    if (!stage || !player)
+        return;
+    if (atomic_load_explicit(&g_outcome, memory_order_relaxed) != SIM_OUTCOME_RUNNING)
+        return;
+
+    save_previous_tick_positions(stage, player);
+
+    // 1. 플레이어 (메인 스레드가 보낸 명령 → 이동)
+    int stepped = apply_player_commands(stage, player);
+
+    int move_finished = update_player_motion(player, dt);
+    if (move_finished && g_held_direction != -1)
+    {
+        step_player(player, g_held_direction, stage);
+        stepped = 1;
+    }
+    if (!stepped)
+        update_player_idle(player, stage->sim_time);
+
+    if (!player->has_backpack &&
+        is_tile_center_inside_player(player, stage->goal_x, stage->goal_y))
+    {
+        player->has_backpack = 1;
+        stage->map[stage->goal_y][stage->goal_x] = ' ';
+        emit_event(SIM_EVENT_BAG_ACQUIRED, SIM_HAZARD_NONE, 0);
+    }
+
+    pick_up_items(stage, player);
+
+    if (player->has_scooter && player->scooter_expire_time > 0.0 && stage->sim_time >= player->scooter_expire_time)
+    {
+        player->has_scooter = 0;
+        player->speed_multiplier = 1.0;
+        player->move_speed = player->base_move_speed * player->speed_multiplier;
+        player->scooter_expire_time = 0.0;
+        emit_event(SIM_EVENT_SCOOTER_EXPIRED, SIM_HAZARD_NONE, 0);
+    }
+
+    move_projectiles(stage, dt);
+
+    // 2. 장애물/교수 패턴/교수 탄환
+    move_obstacles(stage, dt);
+    ProfessorBulletResult bullet_result = update_professor_bullets(stage, player, dt);
+
+    stage->sim_time += dt;
+
+    // 3. 판정
+    check_hazards(stage, player, bullet_result);
+}
@@ -11,8 +11,11 @@
 #include <sys/wait.h>
 #include <fcntl.h>
 #include <stdint.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
 
 #include "sound.h"
+#include "trace.h"
 
 // 사운드
 // - 효과음: SDL 오디오 콜백에서 믹싱
@@ -28,6 +31,7 @@ static pid_t g_sound_worker_pid = -1;
 static int g_sound_pipe[2] = {-1, -1};
 static int g_sound_worker_started = 0;
 static SDL_AudioDeviceID g_sound_device = 0;
+static int g_sfx_muted = 0; // 벤치마크 등 화면/소리 없이 돌릴 때 효과음 요청 무시
 
 #ifndef PATH_MAX
 #define PATH_MAX 4096
@@ -168,6 +172,27 @@ typedef struct
 static PlaybackSlot g_playback_slots[MAX_ACTIVE_PLAYBACKS];
 static pthread_mutex_t g_playback_mutex = PTHREAD_MUTEX_INITIALIZER;
 
+// 믹서는 워커 프로세스에 있으므로, 재생 중인 보이스 수는 fork 전에 만든 공유 페이지로 본 프로세스에 알림
+static atomic_int *g_shared_voice_count = NULL;
+
+// g_playback_mutex를 잡은 상태에서 호출
+static void publish_voice_count_locked(void)
+{
+    if (!g_shared_voice_count)
+    {
+        return;
+    }
+    int active = 0;
+    for (int i = 0; i < MAX_ACTIVE_PLAYBACKS; ++i)
+    {
+        if (g_playback_slots[i].active)
+        {
+            active++;
+        }
+    }
+    atomic_store_explicit(g_shared_voice_count, active, memory_order_relaxed);
+}
+
 static SoundCacheEntry *find_cached_sound(SoundCacheEntry *cache, int cache_count, const char *path)
 {
     for (int i = 0; i < cache_count; ++i)
@@ -293,6 +318,7 @@ static void audio_mix_callback(void *userdata, Uint8 *stream, int len)
         }
     }
 
+    publish_voice_count_locked();
     pthread_mutex_unlock(&g_playback_mutex);
 }
 
@@ -331,6 +357,7 @@ static void start_playback_in_worker(const SoundCacheEntry *entry)
     ps->sound = entry;
     ps->offset = 0;
     ps->active = 1;
+    publish_voice_count_locked();
     pthread_mutex_unlock(&g_playback_mutex);
 
     pthread_t thread;
@@ -342,6 +369,7 @@ static void start_playback_in_worker(const SoundCacheEntry *entry)
     {
         pthread_mutex_lock(&g_playback_mutex);
         ps->active = 0;
+        publish_voice_count_locked();
         pthread_mutex_unlock(&g_playback_mutex);
     }
 }
@@ -477,6 +505,17 @@ static int ensure_sound_worker_started(void)
     fcntl(g_sound_pipe[0], F_SETFD, FD_CLOEXEC);
     fcntl(g_sound_pipe[1], F_SETFD, FD_CLOEXEC);
 
+    if (!g_shared_voice_count)
+    {
+        void *page = mmap(NULL, sizeof(atomic_int), PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (page != MAP_FAILED)
+        {
+            g_shared_voice_count = (atomic_int *)page;
+            atomic_init(g_shared_voice_count, 0);
+        }
+    }
+
     pid_t pid = fork();
     if (pid == 0)
     {
@@ -500,7 +539,7 @@ static int ensure_sound_worker_started(void)
     return 1;
 }
 
-static int send_sound_command(uint16_t type, const char *path)
+static int write_sound_command(uint16_t type, const char *path)
 {
     if (g_sound_pipe[1] == -1)
     {
@@ -539,6 +578,14 @@ static int send_sound_command(uint16_t type, const char *path)
     return 1;
 }
 
+static int send_sound_command(uint16_t type, const char *path)
+{
+    uint64_t trace_send = trace_begin();
+    int ok = write_sound_command(type, path);
+    trace_end("send_sound_command", "audio", trace_send);
+    return ok;
+}
+
 static void preload_known_sounds(void)
 {
     static int done = 0;
@@ -690,12 +737,33 @@ void stop_bgm(void)
 // 논블로킹 효과음 재생 (아이템 획득용)
 // ----------------------------------------------------
 
+// 사운드 워커가 재생 중인 효과음 보이스 수 (워커가 없으면 -1, F3 오버레이용)
+int get_active_sfx_voices(void)
+{
+    if (!g_sound_worker_started || !g_shared_voice_count)
+    {
+        return -1;
+    }
+    return atomic_load_explicit(g_shared_voice_count, memory_order_relaxed);
+}
+
+// 효과음 음소거 (켜면 play_sfx_nonblocking이 아무것도 하지 않음, 벤치마크용)
+void set_sfx_muted(int muted)
+{
+    g_sfx_muted = muted;
+}
+
 /**
  * 짧은 효과음을 논블로킹(Non-blocking) 방식으로 백그라운드에서 재생합니다.
  * (메인 루프 렉(딜레이) 방지)
  */
 void play_sfx_nonblocking(const char *filePath)
 {
+    if (g_sfx_muted)
+    {
+        return;
+    }
+
     if (filePath && ensure_sound_worker_started())
     {
         if (send_sound_command(SOUND_CMD_PLAY, filePath))
@@ -0,0 +1,42 @@
+#include <string.h>
+
+#include "../include/spsc_queue.h"
+
+void spsc_queue_init(SpscQueue *q, void *buffer, unsigned capacity, size_t elem_size)
+{
+    atomic_store_explicit(&q->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&q->tail, 0, memory_order_relaxed);
+    q->capacity = capacity;
+    q->elem_size = elem_size;
+    q->buffer = (unsigned char *)buffer;
+}
+
+int spsc_queue_push(SpscQueue *q, const void *elem)
+{
+    unsigned tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&q->head, memory_order_acquire);
+    if (tail - head >= q->capacity)
+        return 0;
+
+    memcpy(q->buffer + (size_t)(tail & (q->capacity - 1)) * q->elem_size, elem, q->elem_size);
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+    return 1;
+}
+
+int spsc_queue_pop(SpscQueue *q, void *out)
+{
+    unsigned head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+    if (head == tail)
+        return 0;
+
+    memcpy(out, q->buffer + (size_t)(head & (q->capacity - 1)) * q->elem_size, q->elem_size);
+    atomic_store_explicit(&q->head, head + 1, memory_order_release);
+    return 1;
+}
+
+void spsc_queue_clear(SpscQueue *q)
+{
+    unsigned tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+    atomic_store_explicit(&q->head, tail, memory_order_release);
+}
@@ -1,9 +1,15 @@
+#include <errno.h>
 #include <stdio.h>  
 #include <string.h> 
 #include <fcntl.h>  
 #include <unistd.h> 
+#include <time.h>
 
 #include "../include/game.h"
+#include "../include/hazard.h"
+#include "../include/log.h"
+#include "../include/move_field.h"
+#include "../include/pvs.h"
 #include "../include/stage.h"
 
 typedef struct
@@ -12,6 +18,10 @@ typedef struct
     const char *name;
 } StageFileInfo;
 
+// 스테이지 난수 시드 (--seed로 고정하지 않으면 로드할 때마다 시각/프로세스 기반)
+static unsigned long long g_stage_seed_base;
+static int g_stage_seed_fixed;
+
 static const StageFileInfo kStageFiles[] = {
     {"b1.map", "B1"},
     {"1f.map", "1F"},
@@ -251,6 +261,26 @@ int find_stage_id_by_filename(const char *filename)
     return -1;
 }
 
+void set_stage_rng_seed(unsigned long long seed)
+{
+    g_stage_seed_base = seed;
+    g_stage_seed_fixed = 1;
+}
+
+// 고정 시드면 (기본 시드, 스테이지 번호)로만 정해져 같은 스테이지는 항상 같은 순서
+static unsigned long long next_stage_seed(int stage_id)
+{
+    unsigned long long base = g_stage_seed_base;
+    if (!g_stage_seed_fixed)
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        base = ((unsigned long long)ts.tv_sec * 1000000000ull + (unsigned long long)ts.tv_nsec) ^
+               ((unsigned long long)getpid() << 32);
+    }
+    return base ^ ((unsigned long long)stage_id * 0x9E3779B97F4A7C15ull);
+}
+
 int load_stage(Stage *stage, int stage_id)
 {
 
@@ -261,7 +291,7 @@ int load_stage(Stage *stage, int stage_id)
 
     if (stage_id < 1 || stage_id > get_stage_count())
     {
-        fprintf(stderr, "Invalid stage id: %d\n", stage_id);
+        LOG_ERROR(LOG_CAT_STAGE, "Invalid stage id: %d", stage_id);
         return -1;
     }
 
@@ -278,6 +308,8 @@ int load_stage(Stage *stage, int stage_id)
     memset(stage, 0, sizeof(Stage));
 
     stage->id = stage_id; // stage id 인자로 받고 구조체에 저장.
+    stage->rng_seed = next_stage_seed(stage_id);
+    rng_seed(&stage->rng, stage->rng_seed);
 
     // 스테이지 전역 설정 저장 (플레이어/투사체용)
     stage->difficulty_player_speed = diff.player_sec_per_tile;
@@ -291,7 +323,7 @@ int load_stage(Stage *stage, int stage_id)
     int fp = open(filename, O_RDONLY);
     if (fp < 0)
     {
-        perror("open");
+        LOG_ERROR(LOG_CAT_STAGE, "맵 파일을 열 수 없음: %s (%s)", filename, strerror(errno));
         return -1;
     }
 
@@ -410,6 +442,10 @@ int load_stage(Stage *stage, int stage_id)
                         o->hp = 3;
                         o->dir = 0;
                     }
+
+                    // 렌더 보간용 이전 틱 위치
+                    o->prev_world_x = o->world_x;
+                    o->prev_world_y = o->world_y;
                 }
                 stage->map[y][x] = ' ';
             }
@@ -469,5 +505,37 @@ int load_stage(Stage *stage, int stage_id)
 
     load_render_overlay(stage, info->filename);
     cache_passable_tiles(stage);
+
+    hazard_rebuild(stage);
+    stage->pvs = pvs_build(stage);
+    if (!stage->pvs)
+    {
+        LOG_ERROR(LOG_CAT_STAGE, "시야(PVS) 계산 실패: 스테이지 %d", stage_id);
+    }
+    stage->move_field = move_field_build(stage);
+    if (!stage->move_field)
+    {
+        LOG_ERROR(LOG_CAT_STAGE, "이동 판정 비트맵 계산 실패: 스테이지 %d", stage_id);
+    }
     return 0;
 }
+
+void unload_stage(Stage *stage)
+{
+    if (!stage)
+        return;
+
+    pvs_destroy(stage->pvs);
+    stage->pvs = NULL;
+    move_field_destroy(stage->move_field);
+    stage->move_field = NULL;
+}
+
+void stage_on_breakable_wall_destroyed(Stage *stage, int tile_x, int tile_y)
+{
+    if (!stage)
+        return;
+
+    pvs_open_tile(stage->pvs, tile_x, tile_y);
+    move_field_update_tile(stage->move_field, stage, tile_x, tile_y);
+}
@@ -0,0 +1,233 @@
+// 경로 기준 텍스처 캐시
+// - 플레이어 스프라이트처럼 여러 칸이 같은 파일을 가리켜도 디코딩/업로드는 한 번
+// - 항목 수가 수십 개라 선형 탐색
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/asset_loader.h"
+#include "../include/texture_cache.h"
+
+typedef struct
+{
+    char path[PATH_MAX]; // realpath (실패하면 받은 경로 그대로)
+    int refcount;        // 0이면 빈 칸
+    int ticket;          // 디코딩 중인 asset_loader 작업, 없으면 -1
+    SDL_Texture *texture;
+    size_t bytes;
+} TextureCacheEntry;
+
+static SDL_Renderer *g_cache_renderer = NULL;
+static TextureCacheEntry g_entries[TEXTURE_CACHE_MAX_ENTRIES];
+static int g_requested = 0;
+
+static void canonical_path(const char *path, char out[PATH_MAX])
+{
+    if (!realpath(path, out))
+    {
+        snprintf(out, PATH_MAX, "%s", path);
+    }
+}
+
+// 디코딩 결과(RGBA32 픽셀)를 정적 텍스처로 올림. image는 여기서 해제
+static void finish_entry(TextureCacheEntry *entry, AssetImage *image)
+{
+    entry->ticket = -1;
+    if (!image->pixels)
+    {
+        asset_image_free(image);
+        return;
+    }
+
+    SDL_Texture *texture = SDL_CreateTexture(g_cache_renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, image->w, image->h);
+    if (texture && SDL_UpdateTexture(texture, NULL, image->pixels, image->pitch) != 0)
+    {
+        SDL_DestroyTexture(texture);
+        texture = NULL;
+    }
+    if (!texture)
+    {
+        fprintf(stderr, "Texture upload failed for %s: %s\n", entry->path, SDL_GetError());
+        asset_image_free(image);
+        return;
+    }
+    // SDL_CreateTextureFromSurface가 알파 있는 표면에 해 주던 것과 같게
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    entry->texture = texture;
+    entry->bytes = (size_t)image->w * (size_t)image->h * 4u;
+    asset_image_free(image);
+}
+
+void texture_cache_init(SDL_Renderer *renderer)
+{
+    g_cache_renderer = renderer;
+    memset(g_entries, 0, sizeof(g_entries));
+    for (int i = 0; i < TEXTURE_CACHE_MAX_ENTRIES; ++i)
+    {
+        g_entries[i].ticket = -1;
+    }
+    g_requested = 0;
+}
+
+static void clear_entry(TextureCacheEntry *entry)
+{
+    if (entry->ticket >= 0)
+    {
+        // 디코딩 중이면 작업 칸을 돌려받기 위해 결과를 받아 버림
+        AssetImage image;
+        asset_loader_wait(entry->ticket, &image);
+        asset_image_free(&image);
+    }
+    if (entry->texture)
+    {
+        SDL_DestroyTexture(entry->texture);
+    }
+    memset(entry, 0, sizeof(*entry));
+    entry->ticket = -1;
+}
+
+void texture_cache_shutdown(void)
+{
+    for (int i = 0; i < TEXTURE_CACHE_MAX_ENTRIES; ++i)
+    {
+        if (g_entries[i].refcount > 0)
+        {
+            clear_entry(&g_entries[i]);
+        }
+    }
+    g_cache_renderer = NULL;
+}
+
+int texture_cache_request(const char *path)
+{
+    if (!path || !g_cache_renderer)
+    {
+        return -1;
+    }
+
+    char key[PATH_MAX];
+    canonical_path(path, key);
+    g_requested++;
+
+    int free_slot = -1;
+    for (int i = 0; i < TEXTURE_CACHE_MAX_ENTRIES; ++i)
+    {
+        if (g_entries[i].refcount == 0)
+        {
+            if (free_slot < 0)
+            {
+                free_slot = i;
+            }
+            continue;
+        }
+        if (strcmp(g_entries[i].path, key) == 0)
+        {
+            g_entries[i].refcount++;
+            return i;
+        }
+    }
+
+    if (free_slot < 0)
+    {
+        fprintf(stderr, "Texture cache full, cannot load %s\n", path);
+        return -1;
+    }
+
+    TextureCacheEntry *entry = &g_entries[free_slot];
+    memcpy(entry->path, key, sizeof(entry->path));
+    entry->refcount = 1;
+    entry->texture = NULL;
+    entry->bytes = 0;
+    entry->ticket = asset_loader_submit(path);
+    if (entry->ticket < 0)
+    {
+        // 작업 칸이 없으면 여기서 바로 디코딩
+        AssetImage image;
+        asset_image_load(path, &image);
+        finish_entry(entry, &image);
+    }
+    return free_slot;
+}
+
+void texture_cache_release(int entry)
+{
+    if (entry < 0 || entry >= TEXTURE_CACHE_MAX_ENTRIES || g_entries[entry].refcount <= 0)
+    {
+        return;
+    }
+    if (--g_entries[entry].refcount == 0)
+    {
+        clear_entry(&g_entries[entry]);
+    }
+}
+
+int texture_cache_pump(void)
+{
+    int finished = 0;
+    for (int i = 0; i < TEXTURE_CACHE_MAX_ENTRIES; ++i)
+    {
+        TextureCacheEntry *entry = &g_entries[i];
+        AssetImage image;
+        if (entry->refcount > 0 && entry->ticket >= 0 && asset_loader_poll(entry->ticket, &image))
+        {
+            finish_entry(entry, &image);
+            finished++;
+        }
+    }
+    return finished;
+}
+
+int texture_cache_pending(int entry)
+{
+    return entry >= 0 && entry < TEXTURE_CACHE_MAX_ENTRIES && g_entries[entry].ticket >= 0;
+}
+
+SDL_Texture *texture_cache_wait(int entry)
+{
+    if (entry < 0 || entry >= TEXTURE_CACHE_MAX_ENTRIES || g_entries[entry].refcount <= 0)
+    {
+        return NULL;
+    }
+    if (g_entries[entry].ticket >= 0)
+    {
+        AssetImage image;
+        asset_loader_wait(g_entries[entry].ticket, &image);
+        finish_entry(&g_entries[entry], &image);
+    }
+    return g_entries[entry].texture;
+}
+
+SDL_Texture *texture_cache_texture(int entry)
+{
+    if (entry < 0 || entry >= TEXTURE_CACHE_MAX_ENTRIES || g_entries[entry].refcount <= 0)
+    {
+        return NULL;
+    }
+    return g_entries[entry].texture;
+}
+
+void texture_cache_get_stats(TextureCacheStats *out)
+{
+    if (!out)
+    {
+        return;
+    }
+    memset(out, 0, sizeof(*out));
+    out->requested = g_requested;
+    for (int i = 0; i < TEXTURE_CACHE_MAX_ENTRIES; ++i)
+    {
+        if (g_entries[i].refcount <= 0)
+        {
+            continue;
+        }
+        out->unique++;
+        if (g_entries[i].texture)
+        {
+            out->loaded++;
+            out->texture_bytes += g_entries[i].bytes;
+        }
+    }
+}
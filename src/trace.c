@@ -0,0 +1,190 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../include/trace.h"
+
+#define TRACE_MAX_THREADS 32
+#define TRACE_EVENTS_PER_THREAD (1 << 16)
+#define TRACE_THREAD_NAME_MAX 32
+
+typedef struct
+{
+    const char *name;
+    const char *category;
+    uint64_t ts_ns;  // 추적 시작 기준
+    uint64_t dur_ns; // 순간 이벤트면 UINT64_MAX
+} TraceEvent;
+
+typedef struct
+{
+    int tid;
+    char name[TRACE_THREAD_NAME_MAX];
+    atomic_uint count; // 쓴 이벤트 수 (주인 스레드만 증가)
+    unsigned dropped;
+    TraceEvent events[TRACE_EVENTS_PER_THREAD];
+} TraceBuffer;
+
+atomic_int g_trace_enabled = 0;
+
+static char g_trace_path[512];
+static uint64_t g_trace_origin_ns;
+static TraceBuffer *g_buffers[TRACE_MAX_THREADS];
+static atomic_int g_buffer_count = 0;
+static _Thread_local TraceBuffer *t_buffer;
+static _Thread_local int t_buffer_failed;
+
+static uint64_t monotonic_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// 처음 기록하는 스레드에서 한 번만 버퍼 할당/등록
+static TraceBuffer *thread_buffer(void)
+{
+    if (t_buffer || t_buffer_failed)
+        return t_buffer;
+
+    int slot = atomic_fetch_add(&g_buffer_count, 1);
+    TraceBuffer *buffer = (slot < TRACE_MAX_THREADS) ? calloc(1, sizeof(TraceBuffer)) : NULL;
+    if (!buffer)
+    {
+        t_buffer_failed = 1;
+        return NULL;
+    }
+    buffer->tid = slot + 1;
+    snprintf(buffer->name, sizeof(buffer->name), "thread %d", buffer->tid);
+    t_buffer = buffer;
+    g_buffers[slot] = buffer;
+    return buffer;
+}
+
+static void push_event(const char *name, const char *category, uint64_t ts_ns, uint64_t dur_ns)
+{
+    TraceBuffer *buffer = thread_buffer();
+    if (!buffer)
+        return;
+
+    unsigned n = atomic_load_explicit(&buffer->count, memory_order_relaxed);
+    if (n >= TRACE_EVENTS_PER_THREAD)
+    {
+        buffer->dropped++;
+        return;
+    }
+    TraceEvent *ev = &buffer->events[n];
+    ev->name = name;
+    ev->category = category;
+    ev->ts_ns = ts_ns - g_trace_origin_ns;
+    ev->dur_ns = dur_ns;
+    atomic_store_explicit(&buffer->count, n + 1, memory_order_release);
+}
+
+int trace_init(const char *path)
+{
+    if (!path || !path[0])
+        path = getenv("GAME_TRACE");
+    if (!path || !path[0])
+        return 0;
+
+    snprintf(g_trace_path, sizeof(g_trace_path), "%s", path);
+    g_trace_origin_ns = monotonic_ns();
+    atomic_store(&g_trace_enabled, 1);
+    trace_thread_name("main");
+    return 1;
+}
+
+void trace_thread_name(const char *name)
+{
+    if (!trace_enabled())
+        return;
+    TraceBuffer *buffer = thread_buffer();
+    if (buffer)
+        snprintf(buffer->name, sizeof(buffer->name), "%s", name);
+}
+
+uint64_t trace_begin(void)
+{
+    return trace_enabled() ? monotonic_ns() : 0;
+}
+
+void trace_end(const char *name, const char *category, uint64_t begin_ns)
+{
+    if (!trace_enabled() || begin_ns == 0)
+        return;
+    uint64_t now = monotonic_ns();
+    push_event(name, category, begin_ns, now - begin_ns);
+}
+
+void trace_instant(const char *name, const char *category)
+{
+    if (!trace_enabled())
+        return;
+    push_event(name, category, monotonic_ns(), UINT64_MAX);
+}
+
+void trace_shutdown(void)
+{
+    if (!atomic_exchange(&g_trace_enabled, 0))
+        return;
+
+    FILE *fp = fopen(g_trace_path, "w");
+    if (!fp)
+    {
+        fprintf(stderr, "트레이스 파일을 열 수 없습니다: %s\n", g_trace_path);
+        return;
+    }
+
+    const int pid = (int)getpid();
+    int threads = atomic_load(&g_buffer_count);
+    if (threads > TRACE_MAX_THREADS)
+        threads = TRACE_MAX_THREADS;
+
+    unsigned long total = 0;
+    unsigned long dropped = 0;
+    int first = 1;
+    fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (int t = 0; t < threads; ++t)
+    {
+        TraceBuffer *buffer = g_buffers[t];
+        if (!buffer)
+            continue;
+
+        fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                first ? "" : ",\n", pid, buffer->tid, buffer->name);
+        first = 0;
+
+        unsigned count = atomic_load_explicit(&buffer->count, memory_order_acquire);
+        for (unsigned i = 0; i < count; ++i)
+        {
+            const TraceEvent *ev = &buffer->events[i];
+            if (ev->dur_ns == UINT64_MAX)
+            {
+                fprintf(fp, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":%d,\"tid\":%d}",
+                        ev->name, ev->category, ev->ts_ns / 1000.0, pid, buffer->tid);
+            }
+            else
+            {
+                fprintf(fp, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d}",
+                        ev->name, ev->category, ev->ts_ns / 1000.0, ev->dur_ns / 1000.0, pid, buffer->tid);
+            }
+        }
+        total += count;
+        dropped += buffer->dropped;
+    }
+    fprintf(fp, "\n]}\n");
+    fclose(fp);
+
+    // 기록하던 스레드는 모두 멈춘 뒤라 바로 해제
+    for (int t = 0; t < threads; ++t)
+    {
+        free(g_buffers[t]);
+        g_buffers[t] = NULL;
+    }
+
+    printf("트레이스 저장: %s (이벤트 %lu개, 버퍼 초과로 버림 %lu개)\n", g_trace_path, total, dropped);
+}
@@ -0,0 +1,202 @@
+#define _POSIX_C_SOURCE 199309L
+#include <sched.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+
+#include "../include/world_state.h"
+
+// 월드 상태 seqlock
+// - 시퀀스가 홀수면 쓰는 중, 짝수면 안정 상태
+// - 읽는 쪽은 복사 전후 시퀀스가 같고 짝수일 때까지 다시 읽음
+
+typedef struct
+{
+    WorldTickTiming timing;
+    double sim_time;
+
+    Player player;
+    char goal_tile; // 가방을 주우면 ' '로 바뀜
+    int remaining_ammo;
+
+    int num_obstacles;
+    Obstacle obstacles[MAX_OBSTACLES];
+
+    int num_professor_clones;
+    ProfessorClone professor_clones[MAX_PROFESSOR_CLONES];
+
+    int num_professor_bullets;
+    ProfessorBullet professor_bullets[MAX_PROFESSOR_BULLETS];
+
+    int num_items;
+    Item items[MAX_ITEMS];
+
+    int num_projectiles;
+    Projectile projectiles[MAX_PROJECTILES];
+} WorldStateBuffer;
+
+static atomic_uint g_world_seq = 0;
+static WorldStateBuffer g_world;
+
+// 작성자 전용 (g_stage_mutex 보호)
+static WorldTickTiming g_pending_timing;
+
+// 읽는 쪽(메인 스레드)만 갱신, 오버레이/보고용으로 relaxed 읽기
+static atomic_ulong g_read_count = 0;
+static atomic_ulong g_retried_reads = 0;
+static atomic_ulong g_read_retries = 0;
+static atomic_ulong g_retry_wait_max_ns = 0;
+
+static long long monotonic_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// 다시 읽은 횟수와 그만큼 더 걸린 시간 기록 (재시도가 없으면 시계도 읽지 않음)
+static void record_read(unsigned long retries, long long retry_start_ns)
+{
+    atomic_fetch_add_explicit(&g_read_count, 1, memory_order_relaxed);
+    if (retries == 0)
+        return;
+
+    atomic_fetch_add_explicit(&g_retried_reads, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&g_read_retries, retries, memory_order_relaxed);
+    unsigned long waited_ns = (unsigned long)(monotonic_ns() - retry_start_ns);
+    if (waited_ns > atomic_load_explicit(&g_retry_wait_max_ns, memory_order_relaxed))
+        atomic_store_explicit(&g_retry_wait_max_ns, waited_ns, memory_order_relaxed);
+}
+
+void world_state_reset(void)
+{
+    memset(&g_pending_timing, 0, sizeof(g_pending_timing));
+
+    unsigned seq = atomic_load_explicit(&g_world_seq, memory_order_relaxed);
+    atomic_store_explicit(&g_world_seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memset(&g_world, 0, sizeof(g_world));
+    atomic_store_explicit(&g_world_seq, seq + 2, memory_order_release);
+}
+
+void world_state_set_tick_timing(long long tick_time_ns, long long tick_period_ns)
+{
+    g_pending_timing.tick_time_ns = tick_time_ns;
+    g_pending_timing.tick_period_ns = tick_period_ns;
+}
+
+void world_state_publish(const Stage *stage, const Player *player)
+{
+    if (!stage || !player)
+        return;
+
+    g_pending_timing.version++;
+
+    unsigned seq = atomic_load_explicit(&g_world_seq, memory_order_relaxed);
+    atomic_store_explicit(&g_world_seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    g_world.timing = g_pending_timing;
+    g_world.sim_time = stage->sim_time;
+    g_world.player = *player;
+    g_world.goal_tile = stage->map[stage->goal_y][stage->goal_x];
+    g_world.remaining_ammo = stage->remaining_ammo;
+
+    g_world.num_obstacles = stage->num_obstacles;
+    memcpy(g_world.obstacles, stage->obstacles, sizeof(Obstacle) * (size_t)stage->num_obstacles);
+
+    g_world.num_professor_clones = stage->num_professor_clones;
+    memcpy(g_world.professor_clones, stage->professor_clones, sizeof(g_world.professor_clones));
+
+    g_world.num_professor_bullets = stage->num_professor_bullets;
+    memcpy(g_world.professor_bullets, stage->professor_bullets, sizeof(g_world.professor_bullets));
+
+    g_world.num_items = stage->num_items;
+    memcpy(g_world.items, stage->items, sizeof(Item) * (size_t)stage->num_items);
+
+    g_world.num_projectiles = stage->num_projectiles;
+    memcpy(g_world.projectiles, stage->projectiles, sizeof(Projectile) * (size_t)stage->num_projectiles);
+
+    atomic_store_explicit(&g_world_seq, seq + 2, memory_order_release);
+}
+
+void world_state_read(Stage *view, Player *player, WorldTickTiming *timing)
+{
+    if (!view || !player)
+        return;
+
+    unsigned long retries = 0;
+    long long retry_start_ns = 0;
+    for (;; ++retries)
+    {
+        if (retries == 1)
+            retry_start_ns = monotonic_ns();
+
+        unsigned begin = atomic_load_explicit(&g_world_seq, memory_order_acquire);
+        if (begin & 1u)
+        {
+            sched_yield();
+            continue;
+        }
+
+        // 쓰는 도중 값일 수 있으므로 개수는 범위를 잘라서 사용 (불일치하면 어차피 다시 읽음)
+        int num_obstacles = g_world.num_obstacles;
+        if (num_obstacles < 0 || num_obstacles > MAX_OBSTACLES)
+            num_obstacles = 0;
+        int num_items = g_world.num_items;
+        if (num_items < 0 || num_items > MAX_ITEMS)
+            num_items = 0;
+        int num_projectiles = g_world.num_projectiles;
+        if (num_projectiles < 0 || num_projectiles > MAX_PROJECTILES)
+            num_projectiles = 0;
+
+        view->sim_time = g_world.sim_time;
+        *player = g_world.player;
+        view->map[view->goal_y][view->goal_x] = g_world.goal_tile;
+        view->remaining_ammo = g_world.remaining_ammo;
+
+        view->num_obstacles = num_obstacles;
+        memcpy(view->obstacles, g_world.obstacles, sizeof(Obstacle) * (size_t)num_obstacles);
+        view->num_professor_clones = g_world.num_professor_clones;
+        memcpy(view->professor_clones, g_world.professor_clones, sizeof(view->professor_clones));
+        view->num_professor_bullets = g_world.num_professor_bullets;
+        memcpy(view->professor_bullets, g_world.professor_bullets, sizeof(view->professor_bullets));
+        view->num_items = num_items;
+        memcpy(view->items, g_world.items, sizeof(Item) * (size_t)num_items);
+        view->num_projectiles = num_projectiles;
+        memcpy(view->projectiles, g_world.projectiles, sizeof(Projectile) * (size_t)num_projectiles);
+        if (timing)
+            *timing = g_world.timing;
+
+        atomic_thread_fence(memory_order_acquire);
+        unsigned end = atomic_load_explicit(&g_world_seq, memory_order_relaxed);
+        if (begin == end)
+        {
+            record_read(retries, retry_start_ns);
+            return;
+        }
+    }
+}
+
+void world_state_get_read_stats(WorldStateReadStats *out)
+{
+    if (!out)
+        return;
+    out->reads = atomic_load_explicit(&g_read_count, memory_order_relaxed);
+    out->retried_reads = atomic_load_explicit(&g_retried_reads, memory_order_relaxed);
+    out->retries = atomic_load_explicit(&g_read_retries, memory_order_relaxed);
+    out->retry_wait_max_us = (double)atomic_load_explicit(&g_retry_wait_max_ns, memory_order_relaxed) / 1000.0;
+}
+
+double world_state_tick_alpha(const WorldTickTiming *timing)
+{
+    if (!timing || timing->tick_period_ns <= 0)
+        return 1.0;
+
+    double alpha = (double)(monotonic_ns() - timing->tick_time_ns) / (double)timing->tick_period_ns;
+    if (alpha < 0.0)
+        alpha = 0.0;
+    if (alpha > 1.0)
+        alpha = 1.0;
+    return alpha;
+}